@@ -0,0 +1,76 @@
+/*!
+\file benchmark-augmented-batch.cpp
+Benchmark comparing bilinear voting and weighted accumulation with AugmentedEvent_ vectors and AugmentedEventBatch_.
+*/
+#include "benchmark.hpp"
+#include "openev/containers/augmented-batch.hpp"
+#include "openev/containers/batch.hpp"
+#include "openev/containers/vector.hpp"
+#include "openev/core/types.hpp"
+#include "openev/evproc/voting.hpp"
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <opencv2/core/mat.hpp>
+#include <random>
+#include <vector>
+
+int main(int /*argc*/, const char * /*argv*/[]) {
+  constexpr std::size_t N = 2000000;
+
+  std::mt19937 gen(0);
+  std::uniform_real_distribution<> dis_x(0, 638);
+  std::uniform_real_distribution<> dis_y(0, 478);
+  std::uniform_int_distribution<> dis_p(0, 1);
+
+  ev::Vectord vector;
+  vector.reserve(N);
+  for(std::size_t i = 0; i < N; i++) {
+    vector.emplace_back(dis_x(gen), dis_y(gen), static_cast<double>(i), dis_p(gen));
+  }
+  const ev::EventBatchd batch(vector);
+
+  std::cout << "sizeof(AugmentedEvent): " << sizeof(ev::AugmentedEvent) << " bytes" << '\n';
+
+  std::vector<ev::AugmentedEvent> votesVector;
+  ev::AugmentedEventBatch votesBatch;
+  cv::Mat_<float> image(480, 640, 0.0F);
+  double sink = 0;
+
+  report("Voting (std::vector<AugmentedEvent>)", measure([&]() {
+           votesVector.clear();
+           votesVector.reserve(4 * N);
+           for(const ev::Eventd &e : vector) {
+             const int x = static_cast<int>(std::floor(e.x));
+             const int y = static_cast<int>(std::floor(e.y));
+             const double dx = e.x - x;
+             const double dy = e.y - y;
+             const double w[4] = {(1 - dx) * (1 - dy), dx * (1 - dy), (1 - dx) * dy, dx * dy};
+             for(int k = 0; k < 4; k++) {
+               ev::AugmentedEvent v(x + (k & 1), y + (k >> 1), e.t, e.p);
+               v.weight = w[k];
+               votesVector.push_back(v);
+             }
+           }
+           sink += votesVector.size();
+         }));
+  report("Voting (AugmentedEventBatch)        ", measure([&]() {
+           votesBatch.clear();
+           votesBatch.reserve(4 * N);
+           ev::bilinearVoting(batch, votesBatch);
+           sink += votesBatch.size();
+         }));
+  report("Accumulate (std::vector)            ", measure([&]() {
+           for(const ev::AugmentedEvent &v : votesVector) {
+             image(v.y, v.x) += static_cast<float>(v.weight);
+           }
+           sink += image(240, 320);
+         }));
+  report("Accumulate (AugmentedEventBatch)    ", measure([&]() {
+           votesBatch.accumulate(image);
+           sink += image(240, 320);
+         }));
+
+  std::cout << "(checksum " << sink << ")" << '\n';
+  return 0;
+}
@@ -0,0 +1,62 @@
+/*!
+\file benchmark-bitplane.cpp
+Benchmark comparing byte-per-pixel and bit-packed polarity planes.
+*/
+#include "benchmark.hpp"
+#include "openev/core/matrices.hpp"
+#include "openev/core/types.hpp"
+#include <cstddef>
+#include <iostream>
+#include <opencv2/core/mat.hpp>
+#include <random>
+#include <vector>
+
+int main(int /*argc*/, const char * /*argv*/[]) {
+  constexpr int W = 1280;
+  constexpr int H = 720;
+  constexpr std::size_t N = 500000;
+
+  std::mt19937 gen(0);
+  std::uniform_int_distribution<> dis_x(0, W - 1);
+  std::uniform_int_distribution<> dis_y(0, H - 1);
+  std::uniform_int_distribution<> dis_p(0, 1);
+  std::vector<ev::Event> events;
+  events.reserve(N);
+  for(std::size_t i = 0; i < N; i++) {
+    events.emplace_back(dis_x(gen), dis_y(gen), static_cast<double>(i), dis_p(gen));
+  }
+
+  ev::Mat::Polarity polarity(H, W);
+  ev::Mat::PackedPolarity packed(H, W);
+  polarity.clear();
+  for(const ev::Event &e : events) {
+    polarity.insert(e);
+    packed.insert(e);
+  }
+
+  cv::Mat_<uchar> on(H, W);
+  cv::Mat_<uchar> off(H, W);
+  double sink = 0;
+  std::cout << "Frame " << W << "x" << H << ": " << W * H << " bytes (bool) vs " << W * H / 8 << " bytes (packed)" << '\n';
+  report("Masks from bool plane  ", measure([&]() {
+           const bool *src = polarity.ptr<bool>(0);
+           uchar *a = on.ptr<uchar>(0);
+           uchar *b = off.ptr<uchar>(0);
+           for(std::size_t i = 0; i < static_cast<std::size_t>(W) * H; i++) {
+             a[i] = src[i] ? 255 : 0;
+             b[i] = src[i] ? 0 : 255;
+           }
+           sink += on(H / 2, W / 2);
+         }));
+  report("Masks from packed plane", measure([&]() {
+           packed.toMask(on, true);
+           packed.toMask(off, false);
+           sink += on(H / 2, W / 2);
+         }));
+  report("Clear bool plane       ", measure([&]() { polarity.clear(); sink += polarity(0, 0); }));
+  report("Clear packed plane     ", measure([&]() { packed.clear(); sink += packed.get(0, 0); }));
+  report("Count packed plane     ", measure([&]() { sink += static_cast<double>(packed.count()); }));
+
+  std::cout << "(checksum " << sink << ")" << '\n';
+  return 0;
+}
@@ -0,0 +1,110 @@
+/*!
+\file benchmark-chunk-queue.cpp
+Benchmark comparing a mutex-protected ev::Queue with the lock-free ev::ChunkQueue for many-to-one and many-to-many hand-off.
+*/
+#include "benchmark.hpp"
+#include "openev/containers/chunk-queue.hpp"
+#include "openev/containers/queue.hpp"
+#include "openev/containers/vector.hpp"
+#include "openev/core/types.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+int main(int /*argc*/, const char * /*argv*/[]) {
+  constexpr std::size_t N = 2000000;
+  constexpr std::size_t CHUNK = 4096;
+
+  ev::Vector events;
+  events.reserve(N);
+  for(std::size_t i = 0; i < N; i++) {
+    events.emplace_back(static_cast<int>(i % 1280), static_cast<int>(i % 720), static_cast<double>(i), i % 2 == 0);
+  }
+
+  double sink = 0;
+  for(const int producers : {2, 4}) {
+    for(const int consumers : {1, 2}) {
+      std::cout << producers << " producers, " << consumers << " consumers" << '\n';
+      const std::size_t total = N * producers;
+
+      report("  Queue + mutex               ", measure([&]() {
+               ev::Queue queue;
+               std::mutex mutex;
+               std::atomic<std::size_t> consumed{0};
+               std::vector<std::thread> threads;
+               for(int k = 0; k < producers; k++) {
+                 threads.emplace_back([&]() {
+                   for(const ev::Event &e : events) {
+                     const std::scoped_lock lock(mutex);
+                     queue.push(e);
+                   }
+                 });
+               }
+               std::vector<double> sums(consumers, 0.0);
+               for(int c = 0; c < consumers; c++) {
+                 threads.emplace_back([&, c]() {
+                   while(consumed.load() < total) {
+                     const std::scoped_lock lock(mutex);
+                     while(!queue.empty()) {
+                       sums[c] += queue.front().t;
+                       queue.pop();
+                       consumed++;
+                     }
+                   }
+                 });
+               }
+               for(std::thread &t : threads) {
+                 t.join();
+               }
+               for(const double s : sums) {
+                 sink += s;
+               }
+             }),
+             total);
+
+      report("  ChunkQueue (4096 per chunk) ", measure([&]() {
+               ev::ChunkQueue queue(64, CHUNK);
+               std::vector<std::thread> threads;
+               for(int k = 0; k < producers; k++) {
+                 threads.emplace_back([&]() {
+                   ev::Vector chunk;
+                   for(std::size_t i = 0; i < N; i += CHUNK) {
+                     chunk.assign(events.begin() + i, events.begin() + std::min(N, i + CHUNK));
+                     queue.push(chunk);
+                   }
+                 });
+               }
+               std::vector<double> sums(consumers, 0.0);
+               std::vector<std::thread> readers;
+               for(int c = 0; c < consumers; c++) {
+                 readers.emplace_back([&, c]() {
+                   ev::Vector chunk;
+                   while(queue.pop(chunk)) {
+                     for(const ev::Event &e : chunk) {
+                       sums[c] += e.t;
+                     }
+                   }
+                 });
+               }
+               for(std::thread &t : threads) {
+                 t.join();
+               }
+               queue.close();
+               for(std::thread &t : readers) {
+                 t.join();
+               }
+               for(const double s : sums) {
+                 sink += s;
+               }
+             }),
+             total);
+    }
+  }
+
+  std::cout << "(checksum " << sink << ")" << '\n';
+  return 0;
+}
@@ -0,0 +1,58 @@
+/*!
+\file benchmark-codec.cpp
+Benchmark comparing hand-written loops and ev::raw codec for raw 64-bit events.
+*/
+#include "benchmark.hpp"
+#include "openev/containers/batch.hpp"
+#include "openev/containers/codec.hpp"
+#include "openev/containers/vector.hpp"
+#include "openev/core/codec.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <vector>
+
+int main(int /*argc*/, const char * /*argv*/[]) {
+  constexpr std::size_t N = 10000000;
+
+  std::mt19937 gen(0);
+  std::uniform_int_distribution<> dis_x(0, 639);
+  std::uniform_int_distribution<> dis_y(0, 479);
+  std::uniform_int_distribution<> dis_p(0, 1);
+
+  ev::Vector_<int, int64_t> vector;
+  vector.reserve(N);
+  for(std::size_t i = 0; i < N; i++) {
+    vector.emplace_back(dis_x(gen), dis_y(gen), static_cast<int64_t>(i), dis_p(gen));
+  }
+  std::vector<uint64_t> data;
+  ev::raw::encode(vector, data);
+
+  ev::Vector_<int, int64_t> out;
+  ev::EventBatch_<int, int64_t> batch;
+  double sink = 0;
+  std::cout << "AVX2: " << (ev::raw::AVX2 ? "yes" : "no") << '\n';
+  report("Hand-written decode loop ", measure([&]() {
+           out.clear();
+           out.reserve(N);
+           uint64_t offset = 0;
+           uint32_t last = 0;
+           for(const uint64_t d : data) {
+             const auto t = static_cast<uint32_t>(d);
+             if(t < last) {
+               offset += uint64_t{1} << 32;
+             }
+             last = t;
+             out.emplace_back(static_cast<int>((d >> 49) & 0x7FFF), static_cast<int>((d >> 34) & 0x7FFF), static_cast<int64_t>(offset + t), static_cast<bool>((d >> 33) & 1));
+           }
+           sink += out.size();
+         }));
+  report("ev::raw decode (Vector)  ", measure([&]() { out.clear(); ev::raw::Decoder decoder; decoder.decode(data, out); sink += out.size(); }));
+  report("ev::raw decode (Batch)   ", measure([&]() { batch.clear(); ev::raw::Decoder decoder; ev::raw::decode(decoder, data, batch); sink += batch.size(); }));
+  report("ev::raw encode (Vector)  ", measure([&]() { ev::raw::encode(vector, data); sink += data.size(); }));
+  report("ev::raw encode (Batch)   ", measure([&]() { ev::raw::encode(batch, data); sink += data.size(); }));
+
+  std::cout << "(checksum " << sink << ")" << '\n';
+  return 0;
+}
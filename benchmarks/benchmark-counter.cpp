@@ -0,0 +1,51 @@
+/*!
+\file benchmark-counter.cpp
+Benchmark comparing per-event and bulk (privatised, multi-threaded) Mat::Counter_ insertion.
+*/
+#include "benchmark.hpp"
+#include "openev/containers/batch.hpp"
+#include "openev/containers/vector.hpp"
+#include "openev/core/matrices.hpp"
+#include "openev/core/types.hpp"
+#include <cstddef>
+#include <iostream>
+#include <opencv2/core/utility.hpp>
+#include <random>
+#include <string>
+
+int main(int /*argc*/, const char * /*argv*/[]) {
+  constexpr std::size_t N = 10000000;
+
+  std::mt19937 gen(0);
+  std::uniform_int_distribution<> dis_x(0, 1279);
+  std::uniform_int_distribution<> dis_y(0, 719);
+  std::uniform_int_distribution<> dis_p(0, 1);
+
+  ev::Vector vector;
+  vector.reserve(N);
+  for(std::size_t i = 0; i < N; i++) {
+    vector.emplace_back(dis_x(gen), dis_y(gen), static_cast<double>(i), dis_p(gen));
+  }
+  const ev::EventBatch batch(vector);
+
+  double sink = 0;
+  ev::Mat::Counter counter(720, 1280);
+  report("Counter_::insert per event    ", measure([&]() {
+           counter.clear();
+           for(const ev::Event &e : vector) {
+             counter.insert(e);
+           }
+           sink += counter(360, 640);
+         }));
+  for(int threads = 1; threads <= cv::getNumThreads(); threads *= 2) {
+    const std::string name = "Counter_::insert(batch), " + std::to_string(threads) + " thr";
+    report(name.c_str(), measure([&]() {
+             counter.clear();
+             counter.insert(batch, threads);
+             sink += counter(360, 640);
+           }));
+  }
+
+  std::cout << "(checksum " << sink << ")" << '\n';
+  return 0;
+}
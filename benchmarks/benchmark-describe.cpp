@@ -0,0 +1,55 @@
+/*!
+\file benchmark-describe.cpp
+Benchmark comparing one pass per statistic with the fused ev::describe kernel.
+*/
+#include "benchmark.hpp"
+#include "openev/containers/batch.hpp"
+#include "openev/containers/deque.hpp"
+#include "openev/containers/describe.hpp"
+#include "openev/containers/vector.hpp"
+#include "openev/core/types.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <numeric>
+#include <random>
+
+template <typename Container>
+static inline double passes(const Container &c) {
+  const ev::Eventd mean = c.mean();
+  const auto [xMin, xMax] = std::minmax_element(c.begin(), c.end(), [](const ev::Event &a, const ev::Event &b) { return a.x < b.x; });
+  const auto [yMin, yMax] = std::minmax_element(c.begin(), c.end(), [](const ev::Event &a, const ev::Event &b) { return a.y < b.y; });
+  const auto [tMin, tMax] = std::minmax_element(c.begin(), c.end(), [](const ev::Event &a, const ev::Event &b) { return a.t < b.t; });
+  const double ratio = std::accumulate(c.begin(), c.end(), 0.0, [](double sum, const ev::Event &e) { return sum + e.p; }) / c.size();
+  const double var = std::accumulate(c.begin(), c.end(), 0.0, [&mean](double sum, const ev::Event &e) { return sum + (e.x - mean.x) * (e.x - mean.x) + (e.y - mean.y) * (e.y - mean.y); }) / c.size();
+  return mean.t + xMax->x - xMin->x + yMax->y - yMin->y + tMax->t - tMin->t + ratio + var;
+}
+
+int main(int /*argc*/, const char * /*argv*/[]) {
+  constexpr std::size_t N = 5000000;
+
+  std::mt19937 gen(0);
+  std::uniform_int_distribution<> dis_x(0, 1279);
+  std::uniform_int_distribution<> dis_y(0, 719);
+  std::uniform_int_distribution<> dis_p(0, 1);
+
+  ev::Vector vector;
+  vector.reserve(N);
+  for(std::size_t i = 0; i < N; i++) {
+    vector.emplace_back(dis_x(gen), dis_y(gen), 1e9 + static_cast<double>(i), dis_p(gen));
+  }
+  const ev::Deque deque(vector.begin(), vector.end());
+  const ev::EventBatch batch(vector);
+
+  double sink = 0;
+  report("Vector one pass per statistic ", measure([&]() { sink += passes(vector); }));
+  report("Vector describe (1 thread)    ", measure([&]() { sink += ev::describe(vector, 1).spatialVariance(); }));
+  report("Vector describe               ", measure([&]() { sink += ev::describe(vector).spatialVariance(); }));
+  report("Deque one pass per statistic  ", measure([&]() { sink += passes(deque); }));
+  report("Deque describe (1 thread)     ", measure([&]() { sink += ev::describe(deque, 1).spatialVariance(); }));
+  report("EventBatch describe (1 thread)", measure([&]() { sink += ev::describe(batch, 1).spatialVariance(); }));
+
+  std::cout << ev::describe(vector) << '\n';
+  std::cout << "(checksum " << sink << ")" << '\n';
+  return 0;
+}
@@ -0,0 +1,43 @@
+/*!
+\file benchmark-distance.cpp
+Benchmark comparing per-pair Event_::distance and batched distance queries.
+*/
+#include "benchmark.hpp"
+#include "openev/containers/batch.hpp"
+#include "openev/containers/distance.hpp"
+#include "openev/containers/vector.hpp"
+#include "openev/core/types.hpp"
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <vector>
+
+int main(int /*argc*/, const char * /*argv*/[]) {
+  constexpr std::size_t N = 1000000;
+
+  std::mt19937 gen(0);
+  std::uniform_real_distribution<> dis_x(0, 639);
+  std::uniform_real_distribution<> dis_y(0, 479);
+  std::uniform_int_distribution<> dis_p(0, 1);
+
+  ev::Vectord vector;
+  vector.reserve(N);
+  for(std::size_t i = 0; i < N; i++) {
+    vector.emplace_back(dis_x(gen), dis_y(gen), static_cast<double>(i), dis_p(gen));
+  }
+  const ev::EventBatchd batch(vector);
+  const ev::Eventd query(320, 240, N / 2.0, true);
+  std::vector<double> d(N);
+
+  double sink = 0;
+  for(const uint8_t type : {ev::DISTANCE_NORM_L2 | ev::DISTANCE_FLAG_SPATIAL, ev::DISTANCE_NORM_L1 | ev::DISTANCE_FLAG_SPATIOTEMPORAL}) {
+    std::cout << (type == (ev::DISTANCE_NORM_L2 | ev::DISTANCE_FLAG_SPATIAL) ? "L2 spatial" : "L1 spatiotemporal") << '\n';
+    report("  Event_::distance       ", measure([&]() { for(std::size_t i = 0; i < N; i++) { d[i] = query.distance(vector[i], type); } sink += d.back(); }));
+    report("  ev::distance (Vector)  ", measure([&]() { ev::distance(query, vector, d, type); sink += d.back(); }));
+    report("  ev::distance (Batch)   ", measure([&]() { ev::distance(query, batch, d, type); sink += d.back(); }));
+  }
+  report("ev::knn k=16 (Batch)     ", measure([&]() { sink += static_cast<double>(ev::knn(query, batch, 16).front()); }));
+
+  std::cout << "(checksum " << sink << ")" << '\n';
+  return 0;
+}
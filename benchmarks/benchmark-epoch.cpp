@@ -0,0 +1,52 @@
+/*!
+\file benchmark-epoch.cpp
+Benchmark comparing eager and lazy (RepresentationOptions::LAZY_CLEAR) clearing for short, high-frame-rate windows.
+*/
+#include "benchmark.hpp"
+#include "openev/containers/vector.hpp"
+#include "openev/core/types.hpp"
+#include "openev/representations/event-histogram.hpp"
+#include "openev/representations/event-image.hpp"
+#include <cstddef>
+#include <iostream>
+#include <random>
+
+template <typename R>
+static void run(const char *name, R &representation, const ev::Vector &window, const int frames, double &sink) {
+  report(name, measure([&]() {
+           for(int i = 0; i < frames; i++) {
+             representation.clear();
+             representation.insert(window);
+           }
+           sink += representation.count();
+         }));
+}
+
+int main(int /*argc*/, const char * /*argv*/[]) {
+  constexpr std::size_t N = 2000;
+  constexpr int FRAMES = 1000;
+
+  std::mt19937 gen(0);
+  std::uniform_int_distribution<> dis_x(0, 1279);
+  std::uniform_int_distribution<> dis_y(0, 719);
+  std::uniform_int_distribution<> dis_p(0, 1);
+
+  ev::Vector window;
+  window.reserve(N);
+  for(std::size_t i = 0; i < N; i++) {
+    window.emplace_back(dis_x(gen), dis_y(gen), static_cast<double>(i), dis_p(gen));
+  }
+
+  double sink = 0;
+  ev::EventImage1b image(720, 1280);
+  ev::EventImage_<uchar, ev::RepresentationOptions::LAZY_CLEAR> lazyImage(720, 1280);
+  ev::EventHistogram1b histogram(720, 1280);
+  ev::EventHistogram_<uchar, ev::RepresentationOptions::LAZY_CLEAR> lazyHistogram(720, 1280);
+  run("EventImage clear+insert (eager)    ", image, window, FRAMES, sink);
+  run("EventImage clear+insert (lazy)     ", lazyImage, window, FRAMES, sink);
+  run("EventHistogram clear+insert (eager)", histogram, window, FRAMES, sink);
+  run("EventHistogram clear+insert (lazy) ", lazyHistogram, window, FRAMES, sink);
+
+  std::cout << "(checksum " << sink << ")" << '\n';
+  return 0;
+}
@@ -0,0 +1,40 @@
+/*!
+\file benchmark-event-batch.cpp
+Benchmark comparing Vector (array of structures) and EventBatch (structure of arrays).
+*/
+#include "benchmark.hpp"
+#include "openev/containers/batch.hpp"
+#include "openev/containers/vector.hpp"
+#include "openev/core/types.hpp"
+#include <cstddef>
+#include <iostream>
+#include <random>
+
+int main(int /*argc*/, const char * /*argv*/[]) {
+  constexpr std::size_t N = 10000000;
+
+  std::mt19937 gen(0);
+  std::uniform_int_distribution<> dis_x(0, 639);
+  std::uniform_int_distribution<> dis_y(0, 479);
+  std::uniform_int_distribution<> dis_p(0, 1);
+
+  ev::Vector vector;
+  vector.reserve(N);
+  for(std::size_t i = 0; i < N; i++) {
+    vector.emplace_back(dis_x(gen), dis_y(gen), static_cast<double>(i), dis_p(gen));
+  }
+  ev::EventBatch batch(vector);
+
+  double sink = 0;
+  report("Vector mean          ", measure([&]() { sink += vector.mean().x; }));
+  report("EventBatch mean      ", measure([&]() { sink += batch.mean().x; }));
+  report("Vector meanPoint     ", measure([&]() { sink += vector.meanPoint().x; }));
+  report("EventBatch meanPoint ", measure([&]() { sink += batch.meanPoint().x; }));
+  report("Vector meanTime      ", measure([&]() { sink += vector.meanTime(); }));
+  report("EventBatch meanTime  ", measure([&]() { sink += batch.meanTime(); }));
+  report("Vector to EventBatch ", measure([&]() { batch.assign(vector); sink += batch.back().t; }));
+  report("EventBatch to Vector ", measure([&]() { const ev::Vector v = batch.toVector(); sink += v.back().t; }));
+
+  std::cout << "(checksum " << sink << ")" << '\n';
+  return 0;
+}
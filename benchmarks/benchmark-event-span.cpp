@@ -0,0 +1,82 @@
+/*!
+\file benchmark-event-span.cpp
+Benchmark comparing time-window selection by copying into an ev::Vector with ev::EventSpan slicing, followed by a region filter and raw encoding of the window.
+*/
+#include "benchmark.hpp"
+#include "openev/containers/codec.hpp"
+#include "openev/containers/event-span.hpp"
+#include "openev/containers/region.hpp"
+#include "openev/containers/vector.hpp"
+#include "openev/core/types.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <vector>
+
+int main(int /*argc*/, const char * /*argv*/[]) {
+  constexpr std::size_t N = 1000000;
+  constexpr double WINDOW = 10000;
+  constexpr std::size_t QUERIES = 100;
+
+  std::mt19937 gen(0);
+  std::uniform_int_distribution<> dis_x(0, 1279);
+  std::uniform_int_distribution<> dis_y(0, 719);
+  std::uniform_int_distribution<> dis_p(0, 1);
+  std::uniform_real_distribution<> dis_t(0, N - WINDOW);
+
+  ev::Vector events;
+  events.reserve(N);
+  for(std::size_t i = 0; i < N; i++) {
+    events.emplace_back(dis_x(gen), dis_y(gen), static_cast<double>(i), dis_p(gen));
+  }
+  std::vector<double> starts(QUERIES);
+  for(double &t : starts) {
+    t = dis_t(gen);
+  }
+
+  const ev::Rect rect(320, 180, 640, 360);
+  double sink = 0;
+
+  report("Vector copy (linear scan), meanTime() ", measure([&]() {
+           for(const double t0 : starts) {
+             ev::Vector window;
+             for(const ev::Event &e : events) {
+               if(e.t >= t0 && e.t < t0 + WINDOW) {
+                 window.push_back(e);
+               }
+             }
+             sink += window.meanTime();
+           }
+         }));
+
+  report("EventSpan slice_t, meanTime()         ", measure([&]() {
+           for(const double t0 : starts) {
+             sink += events.slice_t(t0, t0 + WINDOW).meanTime();
+           }
+         }));
+
+  ev::Vector filtered;
+  std::vector<uint64_t> raw;
+  report("Vector copy + filter + encode         ", measure([&]() {
+           for(const double t0 : starts) {
+             const ev::EventSpan span = events.slice_t(t0, t0 + WINDOW);
+             const ev::Vector window(span.begin(), span.end());
+             ev::filter(rect, window, filtered);
+             ev::raw::encode(window, raw);
+             sink += static_cast<double>(filtered.size() + raw.size());
+           }
+         }));
+
+  report("EventSpan + filter + encode           ", measure([&]() {
+           for(const double t0 : starts) {
+             const ev::EventSpan span = events.slice_t(t0, t0 + WINDOW);
+             ev::filter(rect, span, filtered);
+             ev::raw::encode(span, raw);
+             sink += static_cast<double>(filtered.size() + raw.size());
+           }
+         }));
+
+  std::cout << "(checksum " << sink << ")" << '\n';
+  return 0;
+}
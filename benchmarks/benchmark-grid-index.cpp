@@ -0,0 +1,59 @@
+/*!
+\file benchmark-grid-index.cpp
+Benchmark comparing linear-scan and grid-indexed neighbourhood queries.
+*/
+#include "benchmark.hpp"
+#include "openev/containers/grid-index.hpp"
+#include "openev/containers/vector.hpp"
+#include "openev/core/types.hpp"
+#include <cmath>
+#include <cstddef>
+#include <iostream>
+#include <random>
+
+int main(int /*argc*/, const char * /*argv*/[]) {
+  constexpr std::size_t N = 1000000;
+  constexpr std::size_t Q = 1000;
+  constexpr int RADIUS = 3;
+  constexpr double DT = 5000;
+
+  std::mt19937 gen(0);
+  std::uniform_int_distribution<> dis_x(0, 639);
+  std::uniform_int_distribution<> dis_y(0, 479);
+  std::uniform_int_distribution<> dis_p(0, 1);
+
+  ev::Vector vector;
+  vector.reserve(N);
+  for(std::size_t i = 0; i < N; i++) {
+    vector.emplace_back(dis_x(gen), dis_y(gen), static_cast<double>(i), dis_p(gen));
+  }
+
+  ev::EventGridIndex index(cv::Size(640, 480), 8);
+  report("EventGridIndex insert        ", measure([&]() { index.clear(); index.insert(vector); }, 1));
+
+  ev::Vector out;
+  double sink = 0;
+  const auto linear = [&]() {
+    for(std::size_t q = 0; q < Q; q++) {
+      const ev::Event &e = vector[q * (N / Q)];
+      out.clear();
+      for(const ev::Event &other : vector) {
+        if(e.distance(other) <= RADIUS && std::abs(other.t - e.t) <= DT) {
+          out.push_back(other);
+        }
+      }
+      sink += out.size();
+    }
+  };
+  const auto grid = [&]() {
+    for(std::size_t q = 0; q < Q; q++) {
+      out.clear();
+      sink += index.neighbours(vector[q * (N / Q)], RADIUS, DT, out);
+    }
+  };
+  report("Linear scan (1000 queries)   ", measure(linear, 1));
+  report("EventGridIndex (1000 queries)", measure(grid));
+
+  std::cout << "(checksum " << sink << ")" << '\n';
+  return 0;
+}
@@ -0,0 +1,41 @@
+/*!
+\file benchmark-packed-event.cpp
+Benchmark comparing Vector (24-byte events) and PackedVector (16-byte events).
+*/
+#include "benchmark.hpp"
+#include "openev/containers/packed.hpp"
+#include "openev/containers/vector.hpp"
+#include "openev/core/types.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+
+int main(int /*argc*/, const char * /*argv*/[]) {
+  constexpr std::size_t N = 10000000;
+
+  std::mt19937 gen(0);
+  std::uniform_int_distribution<> dis_x(0, 639);
+  std::uniform_int_distribution<> dis_y(0, 479);
+  std::uniform_int_distribution<> dis_p(0, 1);
+
+  ev::Vector vector;
+  vector.reserve(N);
+  for(std::size_t i = 0; i < N; i++) {
+    vector.emplace_back(dis_x(gen), dis_y(gen), static_cast<double>(i), dis_p(gen));
+  }
+  const ev::PackedVector packed(vector);
+
+  std::cout << "sizeof(ev::Event) = " << sizeof(ev::Event) << ", sizeof(ev::PackedEvent) = " << sizeof(ev::PackedEvent) << '\n';
+
+  double sink = 0;
+  reportBandwidth("Vector copy      ", measure([&]() { ev::Vector copy(vector); sink += copy.back().t; }), 2 * N * sizeof(ev::Event));
+  reportBandwidth("PackedVector copy", measure([&]() { ev::PackedVector copy(packed); sink += copy.back().t; }), 2 * N * sizeof(ev::PackedEvent));
+  reportBandwidth("Vector mean      ", measure([&]() { sink += vector.mean().x; }), N * sizeof(ev::Event));
+  reportBandwidth("PackedVector mean", measure([&]() { sink += packed.mean().x; }), N * sizeof(ev::PackedEvent));
+  reportBandwidth("Pack             ", measure([&]() { const ev::PackedVector p(vector); sink += p.back().t; }), N * (sizeof(ev::Event) + sizeof(ev::PackedEvent)));
+  reportBandwidth("Unpack           ", measure([&]() { const ev::Vector v = packed.unpack(); sink += v.back().t; }), N * (sizeof(ev::Event) + sizeof(ev::PackedEvent)));
+
+  std::cout << "(checksum " << sink << ")" << '\n';
+  return 0;
+}
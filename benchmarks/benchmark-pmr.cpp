@@ -0,0 +1,83 @@
+/*!
+\file benchmark-pmr.cpp
+Benchmark comparing per-frame event containers using the default allocator with ev::pmr containers backed by an arena or a pool.
+*/
+#include "benchmark.hpp"
+#include "openev/containers/deque.hpp"
+#include "openev/containers/pmr.hpp"
+#include "openev/containers/vector.hpp"
+#include "openev/core/types.hpp"
+#include <cstddef>
+#include <iostream>
+#include <memory_resource>
+#include <random>
+#include <vector>
+
+int main(int /*argc*/, const char * /*argv*/[]) {
+  constexpr std::size_t FRAMES = 1000;
+  constexpr std::size_t EVENTS = 5000;
+
+  std::mt19937 gen(0);
+  std::uniform_int_distribution<> dis_x(0, 1279);
+  std::uniform_int_distribution<> dis_y(0, 719);
+  std::uniform_int_distribution<> dis_p(0, 1);
+
+  std::vector<ev::Event> events;
+  events.reserve(EVENTS);
+  for(std::size_t i = 0; i < EVENTS; i++) {
+    events.emplace_back(dis_x(gen), dis_y(gen), static_cast<double>(i), dis_p(gen));
+  }
+
+  double sink = 0;
+
+  report("Vector created every frame              ", measure([&]() {
+           for(std::size_t f = 0; f < FRAMES; f++) {
+             ev::Vector frame;
+             for(const ev::Event &e : events) {
+               frame.push_back(e);
+             }
+             sink += frame.back().x;
+           }
+         }));
+
+  std::vector<std::byte> buffer(1 << 20);
+  ev::pmr::Arena arena(buffer.data(), buffer.size());
+  report("pmr::Vector on arena, released per frame", measure([&]() {
+           for(std::size_t f = 0; f < FRAMES; f++) {
+             {
+               ev::pmr::Vector frame(&arena);
+               for(const ev::Event &e : events) {
+                 frame.push_back(e);
+               }
+               sink += frame.back().x;
+             }
+             arena.release();
+           }
+         }));
+
+  report("Deque push/pop                          ", measure([&]() {
+           ev::Deque deque;
+           for(std::size_t f = 0; f < FRAMES; f++) {
+             for(const ev::Event &e : events) {
+               deque.push_back(e);
+             }
+             sink += deque.back().x;
+             deque.clear();
+           }
+         }));
+
+  ev::pmr::Pool pool;
+  report("pmr::Deque on pool push/pop             ", measure([&]() {
+           ev::pmr::Deque deque(&pool);
+           for(std::size_t f = 0; f < FRAMES; f++) {
+             for(const ev::Event &e : events) {
+               deque.push_back(e);
+             }
+             sink += deque.back().x;
+             deque.clear();
+           }
+         }));
+
+  std::cout << "(checksum " << sink << ")" << '\n';
+  return 0;
+}
@@ -0,0 +1,73 @@
+/*!
+\file benchmark-polarity-counter.cpp
+Benchmark comparing two-channel ON/OFF histograms built with two Mat::Counter_ plus a conversion pass, and with Mat::PolarityCounter_.
+*/
+#include "benchmark.hpp"
+#include "openev/core/matrices.hpp"
+#include "openev/core/types.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <opencv2/core/mat.hpp>
+#include <random>
+#include <vector>
+
+int main(int /*argc*/, const char * /*argv*/[]) {
+  constexpr std::size_t N = 1000000;
+  constexpr int ROWS = 720;
+  constexpr int COLS = 1280;
+
+  std::mt19937 gen(0);
+  std::uniform_int_distribution<> dis_x(0, COLS - 1);
+  std::uniform_int_distribution<> dis_y(0, ROWS - 1);
+  std::uniform_int_distribution<> dis_p(0, 1);
+
+  std::vector<ev::Event> events;
+  events.reserve(N);
+  for(std::size_t i = 0; i < N; i++) {
+    events.emplace_back(dis_x(gen), dis_y(gen), static_cast<double>(i), dis_p(gen));
+  }
+
+  double sink = 0;
+  ev::Mat::Counter on(ROWS, COLS);
+  ev::Mat::Counter off(ROWS, COLS);
+  cv::Mat_<cv::Vec2b> input(ROWS, COLS);
+  report("2x Counter + conversion (Vec2b)", measure([&]() {
+           on.clear();
+           off.clear();
+           for(const ev::Event &e : events) {
+             (e.p ? on : off).insert(ev::Event(e.x, e.y, e.t, ev::POSITIVE));
+           }
+           for(int y = 0; y < ROWS; y++) {
+             const int *a = on.ptr<int>(y);
+             const int *b = off.ptr<int>(y);
+             cv::Vec2b *out = input.ptr<cv::Vec2b>(y);
+             for(int x = 0; x < COLS; x++) {
+               out[x] = cv::Vec2b(static_cast<uchar>(std::min(a[x], 255)), static_cast<uchar>(std::min(b[x], 255)));
+             }
+           }
+           sink += input(360, 640)[0];
+         }));
+
+  ev::Mat::PolarityCounterb counterb(ROWS, COLS);
+  report("PolarityCounterb               ", measure([&]() {
+           counterb.clear();
+           for(const ev::Event &e : events) {
+             counterb.insert(e);
+           }
+           sink += counterb(360, 640)[0];
+         }));
+
+  ev::Mat::PolarityCounterw counterw(ROWS, COLS);
+  report("PolarityCounterw               ", measure([&]() {
+           counterw.clear();
+           for(const ev::Event &e : events) {
+             counterw.insert(e);
+           }
+           sink += counterw(360, 640)[0];
+         }));
+
+  std::cout << "(checksum " << sink << ")" << '\n';
+  return 0;
+}
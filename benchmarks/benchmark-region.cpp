@@ -0,0 +1,49 @@
+/*!
+\file benchmark-region.cpp
+Benchmark comparing per-event Rect3_/Circ_/MaskROI containment and bulk region filtering.
+*/
+#include "benchmark.hpp"
+#include "openev/containers/batch.hpp"
+#include "openev/containers/region.hpp"
+#include "openev/containers/vector.hpp"
+#include "openev/core/roi.hpp"
+#include "openev/core/types.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <random>
+
+int main(int /*argc*/, const char * /*argv*/[]) {
+  constexpr std::size_t N = 10000000;
+
+  std::mt19937 gen(0);
+  std::uniform_int_distribution<> dis_x(0, 639);
+  std::uniform_int_distribution<> dis_y(0, 479);
+  std::uniform_int_distribution<> dis_p(0, 1);
+
+  ev::Vector vector;
+  vector.reserve(N);
+  for(std::size_t i = 0; i < N; i++) {
+    vector.emplace_back(dis_x(gen), dis_y(gen), static_cast<double>(i), dis_p(gen));
+  }
+  const ev::EventBatch batch(vector);
+  const ev::Rect3 rect(100, 100, 0, 400, 300, static_cast<int>(N / 2));
+  const auto region = ev::unite(rect, ev::Circ(cv::Point(320, 240), 100));
+
+  ev::Vector out;
+  ev::EventBatch outBatch;
+  double sink = 0;
+  report("Rect3_::contains copy_if   ", measure([&]() { out.clear(); std::copy_if(vector.begin(), vector.end(), std::back_inserter(out), [&rect](const ev::Event &e) { return rect.contains(e); }); sink += out.size(); }));
+  report("ev::filter Rect3 (Vector)  ", measure([&]() { ev::filter(rect, vector, out); sink += out.size(); }));
+  report("ev::filter Rect3 (Batch)   ", measure([&]() { ev::filter(rect, batch, outBatch); sink += outBatch.size(); }));
+  report("contains copy_if union     ", measure([&]() { out.clear(); std::copy_if(vector.begin(), vector.end(), std::back_inserter(out), [&region](const ev::Event &e) { return region.contains(e); }); sink += out.size(); }));
+  report("ev::filter union (Batch)   ", measure([&]() { ev::filter(region, batch, outBatch); sink += outBatch.size(); }));
+
+  const ev::MaskROI roi(cv::Size(640, 480), region);
+  report("contains copy_if MaskROI   ", measure([&]() { out.clear(); std::copy_if(vector.begin(), vector.end(), std::back_inserter(out), [&roi](const ev::Event &e) { return roi.contains(e); }); sink += out.size(); }));
+  report("ev::filter MaskROI (Batch) ", measure([&]() { ev::filter(roi, batch, outBatch); sink += outBatch.size(); }));
+
+  std::cout << "(checksum " << sink << ")" << '\n';
+  return 0;
+}
@@ -0,0 +1,42 @@
+/*!
+\file benchmark-sensor.cpp
+Benchmark comparing runtime and compile-time sensor geometry in representations and matrices.
+*/
+#include "benchmark.hpp"
+#include "openev/containers/vector.hpp"
+#include "openev/core/matrices.hpp"
+#include "openev/core/sensor.hpp"
+#include "openev/core/types.hpp"
+#include "openev/representations/event-image.hpp"
+#include <cstddef>
+#include <iostream>
+#include <random>
+
+int main(int /*argc*/, const char * /*argv*/[]) {
+  constexpr std::size_t N = 10000000;
+
+  std::mt19937 gen(0);
+  std::uniform_int_distribution<> dis_x(0, 345);
+  std::uniform_int_distribution<> dis_y(0, 259);
+  std::uniform_int_distribution<> dis_p(0, 1);
+
+  ev::Vector vector;
+  vector.reserve(N);
+  for(std::size_t i = 0; i < N; i++) {
+    vector.emplace_back(dis_x(gen), dis_y(gen), static_cast<double>(i), dis_p(gen));
+  }
+
+  ev::EventImage1 dynamicImage(260, 346);
+  ev::EventImage_<uchar, ev::RepresentationOptions::NONE, int, double, ev::SensorDavis346> fixedImage;
+  ev::Mat::Counter dynamicCounter(260, 346);
+  ev::Mat::Counter_<ev::SensorDavis346> fixedCounter;
+
+  double sink = 0;
+  report("EventImage insert (runtime)         ", measure([&]() { dynamicImage.clear(); dynamicImage.insert(vector); sink += dynamicImage.count(); }));
+  report("EventImage insert (SensorDavis346)  ", measure([&]() { fixedImage.clear(); fixedImage.insert(vector); sink += fixedImage.count(); }));
+  report("Mat::Counter insert (runtime)       ", measure([&]() { dynamicCounter.clear(); for(const ev::Event &e : vector) { sink += dynamicCounter.insert(e); } }));
+  report("Mat::Counter insert (SensorDavis346)", measure([&]() { fixedCounter.clear(); for(const ev::Event &e : vector) { sink += fixedCounter.insert(e); } }));
+
+  std::cout << "(checksum " << sink << ")" << '\n';
+  return 0;
+}
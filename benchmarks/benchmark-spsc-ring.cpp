@@ -0,0 +1,124 @@
+/*!
+\file benchmark-spsc-ring.cpp
+Benchmark comparing a mutex-protected ev::Queue with the lock-free ev::SpscRing for producer/consumer hand-off.
+*/
+#include "benchmark.hpp"
+#include "openev/containers/queue.hpp"
+#include "openev/containers/spsc-ring.hpp"
+#include "openev/core/types.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+int main(int /*argc*/, const char * /*argv*/[]) {
+  constexpr std::size_t N = 4000000;
+  constexpr std::size_t CHUNK = 256;
+  constexpr std::size_t CAPACITY = 1 << 14;
+  constexpr std::size_t ROUNDS = 100000;
+
+  std::vector<ev::Event> events;
+  events.reserve(N);
+  for(std::size_t i = 0; i < N; i++) {
+    events.emplace_back(static_cast<int>(i % 1280), static_cast<int>(i % 720), static_cast<double>(i), i % 2 == 0);
+  }
+
+  double sink = 0;
+  report("Queue + mutex, one by one     ", measure([&]() {
+           ev::Queue queue;
+           std::mutex mutex;
+           std::thread producer([&]() {
+             for(const ev::Event &e : events) {
+               const std::scoped_lock lock(mutex);
+               queue.push(e);
+             }
+           });
+           for(std::size_t n = 0; n < N;) {
+             const std::scoped_lock lock(mutex);
+             while(!queue.empty()) {
+               sink += queue.front().t;
+               queue.pop();
+               n++;
+             }
+           }
+           producer.join();
+         }),
+         N);
+
+  report("SpscRing, one by one          ", measure([&]() {
+           ev::SpscRing ring(CAPACITY);
+           std::thread producer([&]() {
+             for(const ev::Event &e : events) {
+               while(!ring.push(e)) {
+                 std::this_thread::yield();
+               }
+             }
+           });
+           ev::Event e;
+           for(std::size_t n = 0; n < N;) {
+             if(ring.pop(e)) {
+               sink += e.t;
+               n++;
+             } else {
+               std::this_thread::yield();
+             }
+           }
+           producer.join();
+         }),
+         N);
+
+  report("SpscRing, push_n/pop_n (256)  ", measure([&]() {
+           ev::SpscRing ring(CAPACITY);
+           std::thread producer([&]() {
+             for(std::size_t i = 0; i < N;) {
+               const std::size_t k = ring.push_n(events.begin() + i, std::min(CHUNK, N - i));
+               i += k;
+               if(k == 0) {
+                 std::this_thread::yield();
+               }
+             }
+           });
+           std::vector<ev::Event> out(CHUNK);
+           for(std::size_t n = 0; n < N;) {
+             const std::size_t k = ring.pop_n(out.begin(), CHUNK);
+             for(std::size_t j = 0; j < k; j++) {
+               sink += out[j].t;
+             }
+             n += k;
+             if(k == 0) {
+               std::this_thread::yield();
+             }
+           }
+           producer.join();
+         }),
+         N);
+
+  const double latency = measure([&]() {
+    ev::SpscRing ping(2);
+    ev::SpscRing pong(2);
+    std::thread echo([&]() {
+      ev::Event e;
+      for(std::size_t i = 0; i < ROUNDS; i++) {
+        while(!ping.pop(e)) {
+          std::this_thread::yield();
+        }
+        pong.push(e);
+      }
+    });
+    ev::Event e;
+    for(std::size_t i = 0; i < ROUNDS; i++) {
+      ping.push(events[i]);
+      while(!pong.pop(e)) {
+        std::this_thread::yield();
+      }
+      sink += e.t;
+    }
+    echo.join();
+  });
+  std::cout << "SpscRing round trip           : " << latency / ROUNDS * 1e9 << " ns" << '\n';
+
+  std::cout << "(checksum " << sink << ")" << '\n';
+  return 0;
+}
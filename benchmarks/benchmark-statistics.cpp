@@ -0,0 +1,60 @@
+/*!
+\file benchmark-statistics.cpp
+Benchmark comparing on-demand and tracked statistics of a sliding window of events.
+*/
+#include "benchmark.hpp"
+#include "openev/containers/circular.hpp"
+#include "openev/containers/deque.hpp"
+#include "openev/core/types.hpp"
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+int main(int /*argc*/, const char * /*argv*/[]) {
+  constexpr std::size_t N = 200000;
+  constexpr std::size_t WINDOW = 4096;
+  constexpr std::size_t QUERY_EVERY = 64;
+
+  std::mt19937 gen(0);
+  std::uniform_int_distribution<> dis_x(0, 1279);
+  std::uniform_int_distribution<> dis_y(0, 719);
+  std::uniform_int_distribution<> dis_p(0, 1);
+
+  std::vector<ev::Event> events;
+  events.reserve(N);
+  for(std::size_t i = 0; i < N; i++) {
+    events.emplace_back(dis_x(gen), dis_y(gen), 1e9 + static_cast<double>(i), dis_p(gen));
+  }
+
+  double sink = 0;
+  const auto slide = [&](auto &container, const bool tracked) {
+    return [&container, &sink, &events, tracked]() {
+      container.clear();
+      container.track(tracked);
+      for(std::size_t i = 0; i < events.size(); i++) {
+        container.push_back(events[i]);
+        if constexpr(!std::is_same_v<std::decay_t<decltype(container)>, ev::CircularBuffer>) {
+          if(container.size() > WINDOW) {
+            container.pop_front();
+          }
+        }
+        if(i % QUERY_EVERY == 0) {
+          sink += container.meanPoint().x + container.meanTime();
+        }
+      }
+    };
+  };
+
+  ev::CircularBuffer buffer(WINDOW);
+  report("CircularBuffer on-demand mean ", measure(slide(buffer, false)));
+  report("CircularBuffer tracked mean   ", measure(slide(buffer, true)));
+
+  ev::Deque deque;
+  report("Deque on-demand mean          ", measure(slide(deque, false)));
+  report("Deque tracked mean            ", measure(slide(deque, true)));
+
+  std::cout << "(checksum " << sink << ")" << '\n';
+  return 0;
+}
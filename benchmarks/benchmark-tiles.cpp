@@ -0,0 +1,59 @@
+/*!
+\file benchmark-tiles.cpp
+Benchmark comparing full and dirty-tile (RepresentationOptions::TRACK_TILES) clearing for sparse and dense activity.
+*/
+#include "benchmark.hpp"
+#include "openev/containers/vector.hpp"
+#include "openev/core/types.hpp"
+#include "openev/representations/event-histogram.hpp"
+#include "openev/representations/event-image.hpp"
+#include <cstddef>
+#include <iostream>
+#include <random>
+
+template <typename R>
+static void run(const char *name, R &representation, const ev::Vector &window, const int frames, double &sink) {
+  report(name, measure([&]() {
+           for(int i = 0; i < frames; i++) {
+             representation.clear();
+             representation.insert(window);
+           }
+           sink += representation.count();
+         }));
+}
+
+int main(int /*argc*/, const char * /*argv*/[]) {
+  constexpr std::size_t N = 2000;
+  constexpr int FRAMES = 1000;
+
+  std::mt19937 gen(0);
+  std::uniform_int_distribution<> dis_x(0, 1279);
+  std::uniform_int_distribution<> dis_y(0, 719);
+  std::uniform_int_distribution<> dis_sx(600, 727);
+  std::uniform_int_distribution<> dis_sy(300, 395);
+  std::uniform_int_distribution<> dis_p(0, 1);
+
+  ev::Vector dense;
+  ev::Vector sparse;
+  dense.reserve(N);
+  sparse.reserve(N);
+  for(std::size_t i = 0; i < N; i++) {
+    dense.emplace_back(dis_x(gen), dis_y(gen), static_cast<double>(i), dis_p(gen));
+    sparse.emplace_back(dis_sx(gen), dis_sy(gen), static_cast<double>(i), dis_p(gen));
+  }
+
+  double sink = 0;
+  ev::EventImage1b image(720, 1280);
+  ev::EventImage_<uchar, ev::RepresentationOptions::TRACK_TILES> tiledImage(720, 1280);
+  ev::EventHistogram1b histogram(720, 1280);
+  ev::EventHistogram_<uchar, ev::RepresentationOptions::TRACK_TILES> tiledHistogram(720, 1280);
+  run("EventImage sparse (full)      ", image, sparse, FRAMES, sink);
+  run("EventImage sparse (tiles)     ", tiledImage, sparse, FRAMES, sink);
+  run("EventImage dense (full)       ", image, dense, FRAMES, sink);
+  run("EventImage dense (tiles)      ", tiledImage, dense, FRAMES, sink);
+  run("EventHistogram sparse (full)  ", histogram, sparse, FRAMES, sink);
+  run("EventHistogram sparse (tiles) ", tiledHistogram, sparse, FRAMES, sink);
+
+  std::cout << "(checksum " << sink << ")" << '\n';
+  return 0;
+}
@@ -0,0 +1,70 @@
+/*!
+\file benchmark-time-ring.cpp
+Benchmark comparing Mat::Time_ with the multi-slot Mat::TimeRing_ for insertion and windowed counting.
+*/
+#include "benchmark.hpp"
+#include "openev/core/matrices.hpp"
+#include "openev/core/types.hpp"
+#include <cstddef>
+#include <deque>
+#include <iostream>
+#include <opencv2/core/mat.hpp>
+#include <random>
+#include <vector>
+
+int main(int /*argc*/, const char * /*argv*/[]) {
+  constexpr std::size_t N = 5000000;
+  constexpr int ROWS = 720;
+  constexpr int COLS = 1280;
+
+  std::mt19937 gen(0);
+  std::uniform_int_distribution<> dis_x(0, COLS - 1);
+  std::uniform_int_distribution<> dis_y(0, ROWS - 1);
+  std::uniform_int_distribution<> dis_p(0, 1);
+
+  std::vector<ev::Event> events;
+  events.reserve(N);
+  for(std::size_t i = 0; i < N; i++) {
+    events.emplace_back(dis_x(gen), dis_y(gen), static_cast<double>(i), dis_p(gen));
+  }
+  const double t = static_cast<double>(N);
+  const double dt = static_cast<double>(N) / 4;
+
+  double sink = 0;
+  ev::Mat::Time time(ROWS, COLS);
+  time.clear();
+  report("Time_ insert                  ", measure([&]() { for(const ev::Event &e : events) { time.insert(e); } sink += time(360, 640); }));
+
+  std::vector<std::deque<double>> history(static_cast<std::size_t>(ROWS) * COLS);
+  report("per-pixel std::deque (K=4)    ", measure([&]() {
+           for(const ev::Event &e : events) {
+             std::deque<double> &h = history[static_cast<std::size_t>(e.y) * COLS + e.x];
+             h.push_back(e.t);
+             if(h.size() > 4) {
+               h.pop_front();
+             }
+           }
+           sink += static_cast<double>(history[0].size());
+         }));
+
+  ev::Mat::TimeRing<4> ring4(ROWS, COLS);
+  report("TimeRing<4> insert            ", measure([&]() { for(const ev::Event &e : events) { ring4.insert(e); } sink += ring4.timestamp(640, 360); }));
+  ev::Mat::TimeRing<8> ring8(ROWS, COLS);
+  report("TimeRing<8> insert            ", measure([&]() { for(const ev::Event &e : events) { ring8.insert(e); } sink += ring8.timestamp(640, 360); }));
+
+  cv::Mat_<int> counts;
+  report("std::deque count within dt    ", measure([&]() {
+           int n = 0;
+           for(const std::deque<double> &h : history) {
+             for(const double v : h) {
+               n += v >= t - dt;
+             }
+           }
+           sink += n;
+         }));
+  report("TimeRing<4> count within dt   ", measure([&]() { ring4.count(t, dt, counts); sink += counts(360, 640); }));
+  report("TimeRing<8> count within dt   ", measure([&]() { ring8.count(t, dt, counts); sink += counts(360, 640); }));
+
+  std::cout << "(checksum " << sink << ")" << '\n';
+  return 0;
+}
@@ -0,0 +1,91 @@
+/*!
+\file benchmark-time-window.cpp
+Benchmark comparing a hand-made sliding window on ev::Deque with ev::TimeWindow, including a counter kept in sync with the window.
+*/
+#include "benchmark.hpp"
+#include "openev/containers/deque.hpp"
+#include "openev/containers/time-window.hpp"
+#include "openev/core/matrices.hpp"
+#include "openev/core/types.hpp"
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <vector>
+
+int main(int /*argc*/, const char * /*argv*/[]) {
+  constexpr std::size_t N = 1000000;
+  constexpr double WINDOW = 5000;
+  constexpr std::size_t QUERY_EVERY = 1000;
+  constexpr int ROWS = 720;
+  constexpr int COLS = 1280;
+
+  std::mt19937 gen(0);
+  std::uniform_int_distribution<> dis_x(0, COLS - 1);
+  std::uniform_int_distribution<> dis_y(0, ROWS - 1);
+  std::uniform_int_distribution<> dis_p(0, 1);
+
+  std::vector<ev::Event> events;
+  events.reserve(N);
+  for(std::size_t i = 0; i < N; i++) {
+    events.emplace_back(dis_x(gen), dis_y(gen), static_cast<double>(i), dis_p(gen));
+  }
+
+  double sink = 0;
+  ev::Mat::Counter counter(ROWS, COLS);
+
+  report("Deque + pop_front loop, mean()          ", measure([&]() {
+           ev::Deque deque;
+           for(std::size_t i = 0; i < N; i++) {
+             deque.push_back(events[i]);
+             while(deque.front().t < events[i].t - WINDOW) {
+               deque.pop_front();
+             }
+             if(i % QUERY_EVERY == 0) {
+               sink += deque.mean().x;
+             }
+           }
+         }));
+
+  report("TimeWindow, mean()                      ", measure([&]() {
+           ev::TimeWindow window(WINDOW);
+           for(std::size_t i = 0; i < N; i++) {
+             window.push_back(events[i]);
+             if(i % QUERY_EVERY == 0) {
+               sink += window.mean().x;
+             }
+           }
+         }));
+
+  report("Deque, counter rebuilt every query      ", measure([&]() {
+           ev::Deque deque;
+           for(std::size_t i = 0; i < N; i++) {
+             deque.push_back(events[i]);
+             while(deque.front().t < events[i].t - WINDOW) {
+               deque.pop_front();
+             }
+             if(i % QUERY_EVERY == 0) {
+               counter.clear();
+               for(const ev::Event &e : deque) {
+                 counter.insert(e);
+               }
+               sink += counter(360, 640);
+             }
+           }
+         }));
+
+  report("TimeWindow, counter updated on eviction ", measure([&]() {
+           ev::TimeWindow window(WINDOW);
+           counter.clear();
+           window.onEvict([&counter](const ev::Event &e) { counter.remove(e); });
+           for(std::size_t i = 0; i < N; i++) {
+             counter.insert(events[i]);
+             window.push_back(events[i]);
+             if(i % QUERY_EVERY == 0) {
+               sink += counter(360, 640);
+             }
+           }
+         }));
+
+  std::cout << "(checksum " << sink << ")" << '\n';
+  return 0;
+}
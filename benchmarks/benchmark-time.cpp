@@ -0,0 +1,52 @@
+/*!
+\file benchmark-time.cpp
+Benchmark comparing double, float, and relative int32_t storage for Mat::Time_.
+*/
+#include "benchmark.hpp"
+#include "openev/core/matrices.hpp"
+#include "openev/core/types.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <opencv2/core/mat.hpp>
+#include <random>
+#include <vector>
+
+template <typename Ts>
+static void run(const char *insertName, const char *relativeName, const std::vector<ev::Event> &events, double &sink) {
+  ev::Mat::Time_<ev::DynamicSensor, Ts> time(720, 1280);
+  time.clear();
+  report(insertName, measure([&]() {
+           for(const ev::Event &e : events) {
+             time.insert(e);
+           }
+           sink += time.timestamp(640, 360);
+         }));
+  cv::Mat_<typename ev::Mat::Time_<ev::DynamicSensor, Ts>::RenderType> rel;
+  report(relativeName, measure([&]() {
+           time.relative(events.back().t, rel);
+           sink += rel(360, 640);
+         }));
+}
+
+int main(int /*argc*/, const char * /*argv*/[]) {
+  constexpr std::size_t N = 5000000;
+
+  std::mt19937 gen(0);
+  std::uniform_int_distribution<> dis_x(0, 1279);
+  std::uniform_int_distribution<> dis_y(0, 719);
+  std::vector<ev::Event> events;
+  events.reserve(N);
+  for(std::size_t i = 0; i < N; i++) {
+    events.emplace_back(dis_x(gen), dis_y(gen), 1e9 + static_cast<double>(i), true);
+  }
+
+  double sink = 0;
+  std::cout << "Frame 1280x720" << '\n';
+  run<double>("Insert double          ", "Relative double        ", events, sink);
+  run<float>("Insert float           ", "Relative float         ", events, sink);
+  run<int32_t>("Insert int32_t         ", "Relative int32_t       ", events, sink);
+
+  std::cout << "(checksum " << sink << ")" << '\n';
+  return 0;
+}
@@ -0,0 +1,59 @@
+/*!
+\file benchmark.hpp
+Timing and reporting helpers shared by the benchmarks.
+*/
+#ifndef OPENEV_BENCHMARKS_BENCHMARK_HPP
+#define OPENEV_BENCHMARKS_BENCHMARK_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+
+constexpr int REPETITIONS = 10; /*!< Default number of repetitions of each measurement */
+
+/*!
+\brief Measure the mean wall-clock time of a function.
+\param f Function to measure
+\param repetitions Number of repetitions
+\return Mean time in seconds
+*/
+template <typename F>
+static inline double measure(F &&f, const int repetitions = REPETITIONS) {
+  const auto t0 = std::chrono::steady_clock::now();
+  for(int i = 0; i < repetitions; i++) {
+    f();
+  }
+  const auto t1 = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(t1 - t0).count() / repetitions;
+}
+
+/*!
+\brief Print a measurement.
+\param name Name of the measurement
+\param seconds Time in seconds
+*/
+static inline void report(const char *name, const double seconds) {
+  std::cout << name << ": " << seconds * 1e3 << " ms" << '\n';
+}
+
+/*!
+\brief Print a measurement and the event throughput.
+\param name Name of the measurement
+\param seconds Time in seconds
+\param n Number of events processed
+*/
+static inline void report(const char *name, const double seconds, const std::size_t n) {
+  std::cout << name << ": " << seconds * 1e3 << " ms (" << n / seconds * 1e-6 << " Mev/s)" << '\n';
+}
+
+/*!
+\brief Print a measurement and the memory bandwidth.
+\param name Name of the measurement
+\param seconds Time in seconds
+\param bytes Number of bytes read and written
+*/
+static inline void reportBandwidth(const char *name, const double seconds, const std::size_t bytes) {
+  std::cout << name << ": " << seconds * 1e3 << " ms, " << bytes / seconds / 1e9 << " GB/s (" << bytes / 1e6 << " MB)" << '\n';
+}
+
+#endif // OPENEV_BENCHMARKS_BENCHMARK_HPP
@@ -14,7 +14,7 @@
 #include <opencv2/core/mat.inl.hpp>
 
 namespace ev {
-template <typename T>
+template <typename T, typename Tt>
 class Event_;
 
 template <unsigned int N>
@@ -24,18 +24,18 @@ public:
     eFFT<N>::initialize();
   }
 
-  template <typename E = int>
-  inline bool update(const Event_<E> &e, const bool state) {
+  template <typename E = int, typename Tt = double>
+  inline bool update(const Event_<E, Tt> &e, const bool state) {
     return eFFT<N>::update({static_cast<unsigned int>(e.y), static_cast<unsigned int>(e.x), state});
   }
 
-  template <typename E = int>
-  inline bool insert(const Event_<E> &e) {
+  template <typename E = int, typename Tt = double>
+  inline bool insert(const Event_<E, Tt> &e) {
     return eFFT<N>::update({static_cast<unsigned int>(e.y), static_cast<unsigned int>(e.x), true});
   }
 
-  template <typename E = int>
-  inline bool extract(const Event_<E> &e) {
+  template <typename E = int, typename Tt = double>
+  inline bool extract(const Event_<E, Tt> &e) {
     return eFFT<N>::update({static_cast<unsigned int>(e.y), static_cast<unsigned int>(e.x), false});
   }
 
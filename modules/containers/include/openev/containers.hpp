@@ -7,9 +7,24 @@
 #define OPENEV_CONTAINERS_HPP
 
 #include "openev/containers/array.hpp"
+#include "openev/containers/augmented-batch.hpp"
+#include "openev/containers/batch.hpp"
+#include "openev/containers/chunk-queue.hpp"
 #include "openev/containers/circular.hpp"
+#include "openev/containers/codec.hpp"
 #include "openev/containers/deque.hpp"
+#include "openev/containers/describe.hpp"
+#include "openev/containers/distance.hpp"
+#include "openev/containers/event-span.hpp"
+#include "openev/containers/grid-index.hpp"
+#include "openev/containers/packed.hpp"
+#include "openev/containers/pmr.hpp"
 #include "openev/containers/queue.hpp"
+#include "openev/containers/region.hpp"
+#include "openev/containers/span.hpp"
+#include "openev/containers/spsc-ring.hpp"
+#include "openev/containers/statistics.hpp"
+#include "openev/containers/time-window.hpp"
 #include "openev/containers/vector.hpp"
 
 #endif // OPENEV_CONTAINERS_HPP
@@ -6,6 +6,7 @@
 #ifndef OPENEV_CONTAINERS_ARRAY_HPP
 #define OPENEV_CONTAINERS_ARRAY_HPP
 
+#include "openev/containers/event-span.hpp"
 #include "openev/core/types.hpp"
 #include <array>
 #include <cstddef>
@@ -18,17 +19,38 @@ namespace ev {
 
 Event arrays inherit all the properties from standard C++ arrays. Events in the array are stored contiguously.
 */
-template <typename T, std::size_t N>
-class Array_ : public std::array<Event_<T>, N> {
-  using std::array<Event_<T>, N>::array;
+template <typename T, std::size_t N, typename Tt = double>
+class Array_ : public std::array<Event_<T, Tt>, N> {
+  using std::array<Event_<T, Tt>, N>::array;
 
 public:
+  /*!
+  \brief Obtain a view over the events with timestamps in [t0, t1) without copying them.
+  \param t0 Initial time (included)
+  \param t1 Final time (excluded)
+  \return Event span
+  \note Events must be sorted by timestamp. Complexity is logarithmic in the number of events.
+  */
+  [[nodiscard]] inline EventSpan_<T, Tt> slice_t(const double t0, const double t1) const {
+    return EventSpan_<T, Tt>(*this).slice_t(t0, t1);
+  }
+
+  /*!
+  \brief Obtain a view over a range of events without copying them.
+  \param i Index of the first event
+  \param n Number of events
+  \return Event span. It is truncated at the end of the container.
+  */
+  [[nodiscard]] inline EventSpan_<T, Tt> slice_n(const std::size_t i, const std::size_t n) const {
+    return EventSpan_<T, Tt>(*this).slice_n(i, n);
+  }
+
   /*!
   \brief Time difference between the last and the first event.
   \return Time difference
   */
   [[nodiscard]] inline double duration() const {
-    return std::array<ev::Event_<T>, N>::back().t - std::array<ev::Event_<T>, N>::front().t;
+    return std::array<ev::Event_<T, Tt>, N>::back().t - std::array<ev::Event_<T, Tt>, N>::front().t;
   }
 
   /*!
@@ -36,7 +58,7 @@ public:
   \return Event rate
   */
   [[nodiscard]] inline double rate() const {
-    return std::array<ev::Event_<T>, N>::size() / duration();
+    return std::array<ev::Event_<T, Tt>, N>::size() / duration();
   }
 
   /*!
@@ -44,10 +66,10 @@ public:
   \return An Eventd object containing the mean values of x, y, t, and p attributes.
   */
   [[nodiscard]] inline Eventd mean() const {
-    const double x = std::accumulate(std::array<ev::Event_<T>, N>::begin(), std::array<ev::Event_<T>, N>::end(), 0.0, [](double sum, const Event_<T> &e) { return sum + e.x; }) / N;
-    const double y = std::accumulate(std::array<ev::Event_<T>, N>::begin(), std::array<ev::Event_<T>, N>::end(), 0.0, [](double sum, const Event_<T> &e) { return sum + e.y; }) / N;
-    const double t = std::accumulate(std::array<ev::Event_<T>, N>::begin(), std::array<ev::Event_<T>, N>::end(), 0.0, [](double sum, const Event_<T> &e) { return sum + e.t; }) / N;
-    const double p = std::accumulate(std::array<ev::Event_<T>, N>::begin(), std::array<ev::Event_<T>, N>::end(), 0.0, [](double sum, const Event_<T> &e) { return sum + e.p; }) / N;
+    const double x = std::accumulate(std::array<ev::Event_<T, Tt>, N>::begin(), std::array<ev::Event_<T, Tt>, N>::end(), 0.0, [](double sum, const Event_<T, Tt> &e) { return sum + e.x; }) / N;
+    const double y = std::accumulate(std::array<ev::Event_<T, Tt>, N>::begin(), std::array<ev::Event_<T, Tt>, N>::end(), 0.0, [](double sum, const Event_<T, Tt> &e) { return sum + e.y; }) / N;
+    const double t = std::accumulate(std::array<ev::Event_<T, Tt>, N>::begin(), std::array<ev::Event_<T, Tt>, N>::end(), 0.0, [](double sum, const Event_<T, Tt> &e) { return sum + e.t; }) / N;
+    const double p = std::accumulate(std::array<ev::Event_<T, Tt>, N>::begin(), std::array<ev::Event_<T, Tt>, N>::end(), 0.0, [](double sum, const Event_<T, Tt> &e) { return sum + e.p; }) / N;
     return {x, y, t, p > 0.5};
   }
 
@@ -56,8 +78,8 @@ public:
   \return Mean point
   */
   [[nodiscard]] inline cv::Point2d meanPoint() const {
-    const double x = std::accumulate(std::array<ev::Event_<T>, N>::begin(), std::array<ev::Event_<T>, N>::end(), 0.0, [](double sum, const Event_<T> &e) { return sum + e.x; }) / N;
-    const double y = std::accumulate(std::array<ev::Event_<T>, N>::begin(), std::array<ev::Event_<T>, N>::end(), 0.0, [](double sum, const Event_<T> &e) { return sum + e.y; }) / N;
+    const double x = std::accumulate(std::array<ev::Event_<T, Tt>, N>::begin(), std::array<ev::Event_<T, Tt>, N>::end(), 0.0, [](double sum, const Event_<T, Tt> &e) { return sum + e.x; }) / N;
+    const double y = std::accumulate(std::array<ev::Event_<T, Tt>, N>::begin(), std::array<ev::Event_<T, Tt>, N>::end(), 0.0, [](double sum, const Event_<T, Tt> &e) { return sum + e.y; }) / N;
     return {x, y};
   }
 
@@ -66,7 +88,7 @@ public:
   \return Mean time
   */
   [[nodiscard]] inline double meanTime() const {
-    return std::accumulate(std::array<ev::Event_<T>, N>::begin(), std::array<ev::Event_<T>, N>::end(), 0.0, [](double sum, const Event_<T> &e) { return sum + e.t; }) / N;
+    return std::accumulate(std::array<ev::Event_<T, Tt>, N>::begin(), std::array<ev::Event_<T, Tt>, N>::end(), 0.0, [](double sum, const Event_<T, Tt> &e) { return sum + e.t; }) / N;
   }
 
   /*!
@@ -74,7 +96,7 @@ public:
   \return Midpoint time.
   */
   [[nodiscard]] inline double midTime() const {
-    return 0.5 * (std::array<ev::Event_<T>, N>::front().t + std::array<ev::Event_<T>, N>::back().t);
+    return 0.5 * (static_cast<double>(std::array<ev::Event_<T, Tt>, N>::front().t) + static_cast<double>(std::array<ev::Event_<T, Tt>, N>::back().t));
   }
 };
 
@@ -0,0 +1,381 @@
+/*!
+\file augmented-batch.hpp
+\brief Structure-of-arrays container for augmented event structures.
+\author Raul Tapia
+*/
+#ifndef OPENEV_CONTAINERS_AUGMENTED_BATCH_HPP
+#define OPENEV_CONTAINERS_AUGMENTED_BATCH_HPP
+
+#include "openev/containers/batch.hpp"
+#include "openev/containers/span.hpp"
+#include "openev/core/simd.hpp"
+#include "openev/core/types.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <opencv2/core/mat.hpp>
+#include <vector>
+
+namespace ev {
+/*!
+\brief This class implements augmented event batches, i.e., augmented event containers stored as a structure of arrays.
+
+Augmented event batches store the x, y, t, and p attributes of the events in separate columns, as EventBatch_ does, together with a weight column, a depth column, and a stereo column. Weight and depth are stored as float and stereo is bit-packed, so that an augmented event occupies 4 + 4 + 1/8 bytes on top of the basic attributes, whereas AugmentedEvent_ occupies at least 48 bytes.
+
+Weighted kernels (e.g., totalWeight(), accumulate()) run on contiguous arrays. Bilinear voting (ev::bilinearVoting) and undistortion (ev::UndistortMap) can write into augmented event batches directly.
+
+Analogously to OpenCV library, the following aliases are defined for convenience:
+\code{.cpp}
+using AugmentedEventBatchi = AugmentedEventBatch_<int>;
+using AugmentedEventBatchl = AugmentedEventBatch_<long>;
+using AugmentedEventBatchf = AugmentedEventBatch_<float>;
+using AugmentedEventBatchd = AugmentedEventBatch_<double>;
+using AugmentedEventBatch = AugmentedEventBatchi;
+\endcode
+\note Weight and depth are stored in single precision.
+*/
+template <typename T, typename Tt = double>
+class AugmentedEventBatch_ {
+public:
+  template <typename U>
+  using Column = typename EventBatch_<T, Tt>::template Column<U>; /*!< Column type */
+
+  /*!
+  Default constructor.
+  */
+  AugmentedEventBatch_() = default;
+
+  /*!
+  Constructor using an augmented event vector.
+  \param vector Augmented event vector
+  */
+  explicit AugmentedEventBatch_(const std::vector<AugmentedEvent_<T, Tt>> &vector) {
+    assign(vector);
+  }
+
+  /*!
+  Constructor using an event batch. Events get weight 1, depth 0, and left stereo.
+  \param batch Event batch
+  */
+  explicit AugmentedEventBatch_(const EventBatch_<T, Tt> &batch) {
+    assign(batch);
+  }
+
+  /*!
+  \brief Replace the content of the batch with the events in a vector.
+  \param vector Augmented event vector
+  \note Memory is only reallocated if the capacity of the batch is not enough.
+  */
+  inline void assign(const std::vector<AugmentedEvent_<T, Tt>> &vector) {
+    resize(vector.size());
+    for(std::size_t i = 0; i < vector.size(); i++) {
+      x_[i] = vector[i].x;
+      y_[i] = vector[i].y;
+      t_[i] = vector[i].t;
+      p_[i] = vector[i].p;
+      w_[i] = static_cast<float>(vector[i].weight);
+      d_[i] = static_cast<float>(vector[i].depth);
+      setStereo(i, vector[i].stereo);
+    }
+  }
+
+  /*!
+  \brief Replace the content of the batch with the events in an event batch. Events get weight 1, depth 0, and left stereo.
+  \param batch Event batch
+  */
+  inline void assign(const EventBatch_<T, Tt> &batch) {
+    resize(batch.size());
+    std::copy(batch.x().begin(), batch.x().end(), x_.begin());
+    std::copy(batch.y().begin(), batch.y().end(), y_.begin());
+    std::copy(batch.t().begin(), batch.t().end(), t_.begin());
+    std::copy(batch.p().begin(), batch.p().end(), p_.begin());
+    std::fill(w_.begin(), w_.end(), 1.0F);
+    std::fill(d_.begin(), d_.end(), 0.0F);
+    std::fill(s_.begin(), s_.end(), uint64_t{0});
+  }
+
+  /*!
+  \brief Convert the batch into an augmented event vector.
+  \return Augmented event vector
+  */
+  [[nodiscard]] inline std::vector<AugmentedEvent_<T, Tt>> toVector() const {
+    std::vector<AugmentedEvent_<T, Tt>> vector;
+    vector.reserve(size());
+    for(std::size_t i = 0; i < size(); i++) {
+      vector.push_back(operator[](i));
+    }
+    return vector;
+  }
+
+  /*!
+  \brief Number of events in the batch.
+  \return Size
+  */
+  [[nodiscard]] inline std::size_t size() const { return t_.size(); }
+
+  /*!
+  \brief Check if empty.
+  \return True if empty
+  */
+  [[nodiscard]] inline bool empty() const { return t_.empty(); }
+
+  /*!
+  \brief Remove all events from the batch.
+  */
+  inline void clear() {
+    x_.clear();
+    y_.clear();
+    t_.clear();
+    p_.clear();
+    w_.clear();
+    d_.clear();
+    s_.clear();
+  }
+
+  /*!
+  \brief Reserve memory for n events.
+  \param n Number of events
+  */
+  inline void reserve(const std::size_t n) {
+    x_.reserve(n);
+    y_.reserve(n);
+    t_.reserve(n);
+    p_.reserve(n);
+    w_.reserve(n);
+    d_.reserve(n);
+    s_.reserve(words(n));
+  }
+
+  /*!
+  \brief Resize the batch to contain n events.
+  \param n Number of events
+  \note New events get weight 1, depth 0, and left stereo.
+  */
+  inline void resize(const std::size_t n) {
+    const std::size_t m = size();
+    x_.resize(n);
+    y_.resize(n);
+    t_.resize(n);
+    p_.resize(n);
+    w_.resize(n, 1.0F);
+    d_.resize(n, 0.0F);
+    s_.resize(words(n), 0);
+    if(n < m && n % 64 != 0) {
+      s_.back() &= (uint64_t{1} << (n % 64)) - 1;
+    }
+  }
+
+  /*!
+  \brief Add an event at the end of the batch.
+  \param e Augmented event
+  */
+  inline void push_back(const AugmentedEvent_<T, Tt> &e) {
+    emplace_back(e.x, e.y, e.t, e.p, static_cast<float>(e.weight), static_cast<float>(e.depth), e.stereo);
+  }
+
+  /*!
+  \brief Add an event at the end of the batch.
+  \param x Spatial coordinate x
+  \param y Spatial coordinate y
+  \param t Timestamp
+  \param p Polarity
+  \param weight Event weight
+  \param depth Event depth
+  \param stereo Left/right
+  */
+  inline void emplace_back(const T x, const T y, const Tt t, const bool p, const float weight = 1.0F, const float depth = 0.0F, const Stereo stereo = Stereo::LEFT) {
+    const std::size_t i = size();
+    x_.push_back(x);
+    y_.push_back(y);
+    t_.push_back(t);
+    p_.push_back(p);
+    w_.push_back(weight);
+    d_.push_back(depth);
+    if(i % 64 == 0) {
+      s_.push_back(0);
+    }
+    setStereo(i, stereo);
+  }
+
+  /*!
+  \brief Get the i-th event.
+  \param i Index
+  \return Augmented event
+  */
+  [[nodiscard]] inline AugmentedEvent_<T, Tt> operator[](const std::size_t i) const {
+    AugmentedEvent_<T, Tt> e(x_[i], y_[i], t_[i], static_cast<bool>(p_[i]));
+    e.weight = w_[i];
+    e.depth = d_[i];
+    e.stereo = stereo(i);
+    return e;
+  }
+
+  /*!
+  \brief Get the first event.
+  \return Augmented event
+  */
+  [[nodiscard]] inline AugmentedEvent_<T, Tt> front() const { return operator[](0); }
+
+  /*!
+  \brief Get the last event.
+  \return Augmented event
+  */
+  [[nodiscard]] inline AugmentedEvent_<T, Tt> back() const { return operator[](size() - 1); }
+
+  /*!
+  \brief Column of x coordinates.
+  \return Span over the column
+  */
+  [[nodiscard]] inline Span_<T> x() { return {x_.data(), x_.size()}; }
+
+  /*! \cond INTERNAL */
+  [[nodiscard]] inline Span_<const T> x() const { return {x_.data(), x_.size()}; }
+  /*! \endcond */
+
+  /*!
+  \brief Column of y coordinates.
+  \return Span over the column
+  */
+  [[nodiscard]] inline Span_<T> y() { return {y_.data(), y_.size()}; }
+
+  /*! \cond INTERNAL */
+  [[nodiscard]] inline Span_<const T> y() const { return {y_.data(), y_.size()}; }
+  /*! \endcond */
+
+  /*!
+  \brief Column of timestamps.
+  \return Span over the column
+  */
+  [[nodiscard]] inline Span_<Tt> t() { return {t_.data(), t_.size()}; }
+
+  /*! \cond INTERNAL */
+  [[nodiscard]] inline Span_<const Tt> t() const { return {t_.data(), t_.size()}; }
+  /*! \endcond */
+
+  /*!
+  \brief Column of polarities (0 or 1).
+  \return Span over the column
+  */
+  [[nodiscard]] inline Span_<uint8_t> p() { return {p_.data(), p_.size()}; }
+
+  /*! \cond INTERNAL */
+  [[nodiscard]] inline Span_<const uint8_t> p() const { return {p_.data(), p_.size()}; }
+  /*! \endcond */
+
+  /*!
+  \brief Column of weights.
+  \return Span over the column
+  */
+  [[nodiscard]] inline Span_<float> weight() { return {w_.data(), w_.size()}; }
+
+  /*! \cond INTERNAL */
+  [[nodiscard]] inline Span_<const float> weight() const { return {w_.data(), w_.size()}; }
+  /*! \endcond */
+
+  /*!
+  \brief Column of depths.
+  \return Span over the column
+  */
+  [[nodiscard]] inline Span_<float> depth() { return {d_.data(), d_.size()}; }
+
+  /*! \cond INTERNAL */
+  [[nodiscard]] inline Span_<const float> depth() const { return {d_.data(), d_.size()}; }
+  /*! \endcond */
+
+  /*!
+  \brief Get the stereo attribute of the i-th event.
+  \param i Index
+  \return Left/right
+  */
+  [[nodiscard]] inline Stereo stereo(const std::size_t i) const {
+    return ((s_[i >> 6] >> (i & 63U)) & 1U) ? Stereo::RIGHT : Stereo::LEFT;
+  }
+
+  /*!
+  \brief Set the stereo attribute of the i-th event.
+  \param i Index
+  \param stereo Left/right
+  */
+  inline void setStereo(const std::size_t i, const Stereo stereo) {
+    const uint64_t bit = uint64_t{1} << (i & 63U);
+    s_[i >> 6] = stereo == Stereo::RIGHT ? (s_[i >> 6] | bit) : (s_[i >> 6] & ~bit);
+  }
+
+  /*!
+  \brief Time difference between the last and the first event.
+  \return Time difference
+  */
+  [[nodiscard]] inline double duration() const {
+    return static_cast<double>(t_.back() - t_.front());
+  }
+
+  /*!
+  \brief Sum of the weights of the events.
+  \return Total weight
+  */
+  [[nodiscard]] inline double totalWeight() const {
+    return simd::sum(w_.data(), w_.size());
+  }
+
+  /*!
+  \brief Compute the weighted mean x,y point of the events.
+  \return Weighted mean point. If the weights sum to zero, the unweighted mean point is returned, or (0, 0) if the batch is empty.
+  */
+  [[nodiscard]] inline cv::Point2d weightedMeanPoint() const {
+    double sx = 0;
+    double sy = 0;
+    double sw = 0;
+    double ux = 0;
+    double uy = 0;
+    for(std::size_t i = 0; i < size(); i++) {
+      sx += static_cast<double>(w_[i]) * static_cast<double>(x_[i]);
+      sy += static_cast<double>(w_[i]) * static_cast<double>(y_[i]);
+      sw += static_cast<double>(w_[i]);
+      ux += static_cast<double>(x_[i]);
+      uy += static_cast<double>(y_[i]);
+    }
+    if(sw == 0) {
+      if(empty()) {
+        return {0, 0};
+      }
+      const double n = static_cast<double>(size());
+      return {ux / n, uy / n};
+    }
+    return {sx / sw, sy / sw};
+  }
+
+  /*!
+  \brief Accumulate the weights of the events into a matrix.
+  \param m Matrix. Events outside the matrix are ignored.
+  \note Coordinates are truncated to integers.
+  */
+  template <typename Tm>
+  inline void accumulate(cv::Mat_<Tm> &m) const {
+    for(std::size_t i = 0; i < size(); i++) {
+      const int x = static_cast<int>(x_[i]);
+      const int y = static_cast<int>(y_[i]);
+      if(static_cast<unsigned>(x) < static_cast<unsigned>(m.cols) && static_cast<unsigned>(y) < static_cast<unsigned>(m.rows)) {
+        m.template ptr<Tm>(y)[x] += static_cast<Tm>(w_[i]);
+      }
+    }
+  }
+
+private:
+  Column<T> x_;
+  Column<T> y_;
+  Column<Tt> t_;
+  Column<uint8_t> p_;
+  Column<float> w_;
+  Column<float> d_;
+  std::vector<uint64_t> s_;
+
+  [[nodiscard]] static inline std::size_t words(const std::size_t n) { return (n + 63) / 64; }
+};
+using AugmentedEventBatchi = AugmentedEventBatch_<int>;    /*!< Alias for AugmentedEventBatch_ using int */
+using AugmentedEventBatchl = AugmentedEventBatch_<long>;   /*!< Alias for AugmentedEventBatch_ using long */
+using AugmentedEventBatchf = AugmentedEventBatch_<float>;  /*!< Alias for AugmentedEventBatch_ using float */
+using AugmentedEventBatchd = AugmentedEventBatch_<double>; /*!< Alias for AugmentedEventBatch_ using double */
+using AugmentedEventBatch = AugmentedEventBatchi;          /*!< Alias for AugmentedEventBatch_ using int */
+} // namespace ev
+
+#endif // OPENEV_CONTAINERS_AUGMENTED_BATCH_HPP
@@ -0,0 +1,277 @@
+/*!
+\file batch.hpp
+\brief Structure-of-arrays container for basic event structures.
+\author Raul Tapia
+*/
+#ifndef OPENEV_CONTAINERS_BATCH_HPP
+#define OPENEV_CONTAINERS_BATCH_HPP
+
+#include "openev/containers/span.hpp"
+#include "openev/containers/vector.hpp"
+#include "openev/core/simd.hpp"
+#include "openev/core/types.hpp"
+#include <boost/align/aligned_allocator.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <opencv2/core/types.hpp>
+#include <vector>
+
+namespace ev {
+/*!
+\brief This class implements event batches, i.e., event containers stored as a structure of arrays.
+
+Event batches store the x, y, t, and p attributes of the events in separate columns, each of them contiguous and aligned to ev::simd::ALIGNMENT bytes. Column-wise kernels (e.g., mean(), meanTime()) only touch the data they need and are vectorized.
+
+Polarity is stored as uint8_t (0 or 1) so that it can be processed with arithmetic kernels.
+
+Analogously to OpenCV library, the following aliases are defined for convenience:
+\code{.cpp}
+using EventBatchi = EventBatch_<int>;
+using EventBatchl = EventBatch_<long>;
+using EventBatchf = EventBatch_<float>;
+using EventBatchd = EventBatch_<double>;
+using EventBatch = EventBatchi;
+\endcode
+*/
+template <typename T, typename Tt = double>
+class EventBatch_ {
+public:
+  template <typename U>
+  using Column = std::vector<U, boost::alignment::aligned_allocator<U, simd::ALIGNMENT>>; /*!< Column type */
+
+  /*!
+  Default constructor.
+  */
+  EventBatch_() = default;
+
+  /*!
+  Constructor using an event vector.
+  \param vector Event vector
+  */
+  explicit EventBatch_(const Vector_<T, Tt> &vector) {
+    assign(vector);
+  }
+
+  /*!
+  \brief Replace the content of the batch with the events in a vector.
+  \param vector Event vector
+  \note Memory is only reallocated if the capacity of the batch is not enough.
+  */
+  inline void assign(const Vector_<T, Tt> &vector) {
+    resize(vector.size());
+    for(std::size_t i = 0; i < vector.size(); i++) {
+      x_[i] = vector[i].x;
+      y_[i] = vector[i].y;
+      t_[i] = vector[i].t;
+      p_[i] = vector[i].p;
+    }
+  }
+
+  /*!
+  \brief Convert the batch into an event vector.
+  \return Event vector
+  */
+  [[nodiscard]] inline Vector_<T, Tt> toVector() const {
+    Vector_<T, Tt> vector;
+    vector.reserve(size());
+    for(std::size_t i = 0; i < size(); i++) {
+      vector.emplace_back(x_[i], y_[i], t_[i], static_cast<bool>(p_[i]));
+    }
+    return vector;
+  }
+
+  /*!
+  \brief Number of events in the batch.
+  \return Size
+  */
+  [[nodiscard]] inline std::size_t size() const { return t_.size(); }
+
+  /*!
+  \brief Check if empty.
+  \return True if empty
+  */
+  [[nodiscard]] inline bool empty() const { return t_.empty(); }
+
+  /*!
+  \brief Remove all events from the batch.
+  */
+  inline void clear() {
+    x_.clear();
+    y_.clear();
+    t_.clear();
+    p_.clear();
+  }
+
+  /*!
+  \brief Reserve memory for n events.
+  \param n Number of events
+  */
+  inline void reserve(const std::size_t n) {
+    x_.reserve(n);
+    y_.reserve(n);
+    t_.reserve(n);
+    p_.reserve(n);
+  }
+
+  /*!
+  \brief Resize the batch to contain n events.
+  \param n Number of events
+  */
+  inline void resize(const std::size_t n) {
+    x_.resize(n);
+    y_.resize(n);
+    t_.resize(n);
+    p_.resize(n);
+  }
+
+  /*!
+  \brief Add an event at the end of the batch.
+  \param e Event
+  */
+  inline void push_back(const Event_<T, Tt> &e) {
+    emplace_back(e.x, e.y, e.t, e.p);
+  }
+
+  /*!
+  \brief Add an event at the end of the batch.
+  \param x Spatial coordinate x
+  \param y Spatial coordinate y
+  \param t Timestamp
+  \param p Polarity
+  */
+  inline void emplace_back(const T x, const T y, const Tt t, const bool p) {
+    x_.push_back(x);
+    y_.push_back(y);
+    t_.push_back(t);
+    p_.push_back(p);
+  }
+
+  /*!
+  \brief Get the i-th event.
+  \param i Index
+  \return Event
+  */
+  [[nodiscard]] inline Event_<T, Tt> operator[](const std::size_t i) const {
+    return {x_[i], y_[i], t_[i], static_cast<bool>(p_[i])};
+  }
+
+  /*!
+  \brief Get the first event.
+  \return Event
+  */
+  [[nodiscard]] inline Event_<T, Tt> front() const { return operator[](0); }
+
+  /*!
+  \brief Get the last event.
+  \return Event
+  */
+  [[nodiscard]] inline Event_<T, Tt> back() const { return operator[](size() - 1); }
+
+  /*!
+  \brief Column of x coordinates.
+  \return Span over the column
+  */
+  [[nodiscard]] inline Span_<T> x() { return {x_.data(), x_.size()}; }
+
+  /*! \cond INTERNAL */
+  [[nodiscard]] inline Span_<const T> x() const { return {x_.data(), x_.size()}; }
+  /*! \endcond */
+
+  /*!
+  \brief Column of y coordinates.
+  \return Span over the column
+  */
+  [[nodiscard]] inline Span_<T> y() { return {y_.data(), y_.size()}; }
+
+  /*! \cond INTERNAL */
+  [[nodiscard]] inline Span_<const T> y() const { return {y_.data(), y_.size()}; }
+  /*! \endcond */
+
+  /*!
+  \brief Column of timestamps.
+  \return Span over the column
+  */
+  [[nodiscard]] inline Span_<Tt> t() { return {t_.data(), t_.size()}; }
+
+  /*! \cond INTERNAL */
+  [[nodiscard]] inline Span_<const Tt> t() const { return {t_.data(), t_.size()}; }
+  /*! \endcond */
+
+  /*!
+  \brief Column of polarities (0 or 1).
+  \return Span over the column
+  */
+  [[nodiscard]] inline Span_<uint8_t> p() { return {p_.data(), p_.size()}; }
+
+  /*! \cond INTERNAL */
+  [[nodiscard]] inline Span_<const uint8_t> p() const { return {p_.data(), p_.size()}; }
+  /*! \endcond */
+
+  /*!
+  \brief Time difference between the last and the first event.
+  \return Time difference
+  */
+  [[nodiscard]] inline double duration() const {
+    return static_cast<double>(t_.back() - t_.front());
+  }
+
+  /*!
+  \brief Compute event rate as the ratio between the number of events and the time difference between the last and the first event.
+  \return Event rate
+  */
+  [[nodiscard]] inline double rate() const {
+    return size() / duration();
+  }
+
+  /*!
+  \brief Compute the mean of the events.
+  \return An Eventd object containing the mean values of x, y, t, and p attributes.
+  */
+  [[nodiscard]] inline Eventd mean() const {
+    const double n = static_cast<double>(size());
+    const double x = simd::sum(x_.data(), x_.size()) / n;
+    const double y = simd::sum(y_.data(), y_.size()) / n;
+    const double t = meanTime();
+    const double p = simd::sum(p_.data(), p_.size()) / n;
+    return {x, y, t, p > 0.5};
+  }
+
+  /*!
+  \brief Compute the mean x,y point of the events.
+  \return Mean point
+  */
+  [[nodiscard]] inline cv::Point2d meanPoint() const {
+    const double n = static_cast<double>(size());
+    return {simd::sum(x_.data(), x_.size()) / n, simd::sum(y_.data(), y_.size()) / n};
+  }
+
+  /*!
+  \brief Compute the mean time of the events.
+  \return Mean time
+  */
+  [[nodiscard]] inline double meanTime() const {
+    return static_cast<double>(t_.front()) + simd::sum(t_.data(), t_.size(), t_.front()) / static_cast<double>(size());
+  }
+
+  /*!
+  \brief Calculate the midpoint time between the oldest and the newest event.
+  \return Midpoint time.
+  */
+  [[nodiscard]] inline double midTime() const {
+    return 0.5 * (static_cast<double>(t_.front()) + static_cast<double>(t_.back()));
+  }
+
+private:
+  Column<T> x_;
+  Column<T> y_;
+  Column<Tt> t_;
+  Column<uint8_t> p_;
+};
+using EventBatchi = EventBatch_<int>;    /*!< Alias for EventBatch_ using int */
+using EventBatchl = EventBatch_<long>;   /*!< Alias for EventBatch_ using long */
+using EventBatchf = EventBatch_<float>;  /*!< Alias for EventBatch_ using float */
+using EventBatchd = EventBatch_<double>; /*!< Alias for EventBatch_ using double */
+using EventBatch = EventBatchi;          /*!< Alias for EventBatch_ using int */
+} // namespace ev
+
+#endif // OPENEV_CONTAINERS_BATCH_HPP
@@ -0,0 +1,229 @@
+/*!
+\file chunk-queue.hpp
+\brief Lock-free multi-producer/multi-consumer queue of event chunks.
+\author Raul Tapia
+*/
+#ifndef OPENEV_CONTAINERS_CHUNK_QUEUE_HPP
+#define OPENEV_CONTAINERS_CHUNK_QUEUE_HPP
+
+#include "openev/containers/vector.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <utility>
+
+namespace ev {
+/*!
+\brief This class implements a bounded, lock-free queue of event chunks shared by any number of producer and consumer threads.
+
+Events are transferred in chunks (i.e., Vector_ objects) instead of one by one, so the synchronization cost is paid once per chunk. Chunks are swapped in and out of the queue slots: the producer gets back an empty chunk whose storage was used before, and the consumer hands its old chunk over to the queue. Hence, once every slot has been used, no memory is allocated as long as the chunks do not grow beyond the chunk size.
+
+The queue has a fixed number of slots. try_push() and try_pop() return immediately if the queue is full or empty, respectively; push() and pop() wait until they succeed or the queue is closed.
+\code{.cpp}
+ev::ChunkQueue queue(64);
+std::thread left([&]() { while(leftReader.read(queue)) {} });
+std::thread right([&]() { while(rightReader.read(queue)) {} });
+std::thread closer([&]() { left.join(); right.join(); queue.close(); });
+ev::Vector chunk;
+while(queue.pop(chunk)) {
+  process(chunk);
+}
+closer.join();
+\endcode
+\note The number of slots is rounded up to the next power of two, with a minimum of two. Events from different producers are not interleaved within a chunk, but chunks from different producers are.
+*/
+template <typename T, typename Tt = double>
+class ChunkQueue_ {
+public:
+  static constexpr std::size_t CACHE_LINE = 64;              /*!< Size of a cache line in bytes */
+  static constexpr std::size_t DEFAULT_CHUNK_SIZE = 1 << 12; /*!< Default number of events per chunk */
+
+  /*!
+  \brief Constructor.
+  \param slots Minimum number of chunks that the queue can hold. At least two slots are allocated.
+  \param chunk_size Number of events per chunk. It is a hint for producers (e.g., AbstractReader_::read). At least one event per chunk is used.
+  */
+  explicit ChunkQueue_(const std::size_t slots, const std::size_t chunk_size = DEFAULT_CHUNK_SIZE) : chunkSize_{std::max<std::size_t>(chunk_size, 1)} {
+    std::size_t n = 2;
+    while(n < slots) {
+      n <<= 1;
+    }
+    mask_ = n - 1;
+    cells_ = std::make_unique<Cell[]>(n);
+    for(std::size_t i = 0; i < n; i++) {
+      cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  /*!
+  \brief Maximum number of chunks.
+  \return Capacity
+  */
+  [[nodiscard]] inline std::size_t capacity() const { return mask_ + 1; }
+
+  /*!
+  \brief Number of events per chunk.
+  \return Chunk size
+  */
+  [[nodiscard]] inline std::size_t chunkSize() const { return chunkSize_; }
+
+  /*!
+  \brief Number of chunks in the queue.
+  \return Number of chunks
+  \note If called concurrently with producers or consumers, the result is a snapshot that may be outdated.
+  */
+  [[nodiscard]] inline std::size_t size() const {
+    const std::size_t head = dequeuePos_.load(std::memory_order_acquire);
+    const std::size_t tail = enqueuePos_.load(std::memory_order_acquire);
+    return tail > head ? tail - head : 0;
+  }
+
+  /*!
+  \brief Check if the queue is empty.
+  \return True if empty
+  */
+  [[nodiscard]] inline bool empty() const { return size() == 0; }
+
+  /*!
+  \brief Insert a chunk if there is a free slot.
+  \param chunk Chunk of events. On success, it is replaced by an empty chunk.
+  \return False if the queue is full or closed
+  */
+  inline bool try_push(Vector_<T, Tt> &chunk) {
+    const Producer producer(producers_);
+    if(closed()) {
+      return false;
+    }
+    std::size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+    Cell *cell;
+    for(;;) {
+      cell = &cells_[pos & mask_];
+      const std::size_t seq = cell->sequence.load(std::memory_order_acquire);
+      const std::intptr_t diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+      if(diff == 0) {
+        if(enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          break;
+        }
+      } else if(diff < 0) {
+        return false;
+      } else {
+        pos = enqueuePos_.load(std::memory_order_relaxed);
+      }
+    }
+    std::swap(cell->chunk, chunk);
+    chunk.clear();
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  /*!
+  \brief Insert a chunk, waiting for a free slot if necessary.
+  \param chunk Chunk of events. On success, it is replaced by an empty chunk.
+  \return False if the queue is closed
+  */
+  inline bool push(Vector_<T, Tt> &chunk) {
+    for(std::size_t spins = 0; !try_push(chunk); spins++) {
+      if(closed()) {
+        return false;
+      }
+      backoff(spins);
+    }
+    return true;
+  }
+
+  /*!
+  \brief Extract the oldest chunk if there is any.
+  \param chunk Output chunk. Its previous content is discarded.
+  \return False if the queue is empty
+  */
+  inline bool try_pop(Vector_<T, Tt> &chunk) {
+    std::size_t pos = dequeuePos_.load(std::memory_order_relaxed);
+    Cell *cell;
+    for(;;) {
+      cell = &cells_[pos & mask_];
+      const std::size_t seq = cell->sequence.load(std::memory_order_acquire);
+      const std::intptr_t diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos + 1);
+      if(diff == 0) {
+        if(dequeuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          break;
+        }
+      } else if(diff < 0) {
+        return false;
+      } else {
+        pos = dequeuePos_.load(std::memory_order_relaxed);
+      }
+    }
+    std::swap(cell->chunk, chunk);
+    cell->sequence.store(pos + mask_ + 1, std::memory_order_release);
+    return true;
+  }
+
+  /*!
+  \brief Extract the oldest chunk, waiting for one if necessary.
+  \param chunk Output chunk. Its previous content is discarded.
+  \return False if the queue is closed and empty
+  */
+  inline bool pop(Vector_<T, Tt> &chunk) {
+    for(std::size_t spins = 0; !try_pop(chunk); spins++) {
+      if(closed() && producers_.load() == 0 && empty()) {
+        return try_pop(chunk);
+      }
+      backoff(spins);
+    }
+    return true;
+  }
+
+  /*!
+  \brief Close the queue. Further insertions fail, and waiting consumers return once the queue is empty.
+  \note It is safe to close the queue while producers are inserting: consumers wait for the insertions in progress, so no chunk is left in the queue.
+  */
+  inline void close() { closed_.store(true); }
+
+  /*!
+  \brief Check if the queue is closed.
+  \return True if closed
+  */
+  [[nodiscard]] inline bool closed() const { return closed_.load(); }
+
+private:
+  struct alignas(CACHE_LINE) Cell {
+    std::atomic<std::size_t> sequence{0};
+    Vector_<T, Tt> chunk;
+  };
+
+  class Producer {
+  public:
+    explicit Producer(std::atomic<std::size_t> &producers) : producers_{producers} { producers_.fetch_add(1); }
+    ~Producer() { producers_.fetch_sub(1); }
+    Producer(const Producer &) = delete;
+    Producer &operator=(const Producer &) = delete;
+
+  private:
+    std::atomic<std::size_t> &producers_;
+  };
+
+  static inline void backoff(const std::size_t spins) {
+    if(spins > 64) {
+      std::this_thread::yield();
+    }
+  }
+
+  alignas(CACHE_LINE) std::atomic<std::size_t> enqueuePos_{0};
+  alignas(CACHE_LINE) std::atomic<std::size_t> dequeuePos_{0};
+  alignas(CACHE_LINE) std::atomic<bool> closed_{false};
+  alignas(CACHE_LINE) std::atomic<std::size_t> producers_{0};
+  std::unique_ptr<Cell[]> cells_;
+  std::size_t mask_{0};
+  std::size_t chunkSize_;
+};
+using ChunkQueuei = ChunkQueue_<int>;    /*!< Alias for ChunkQueue_ using int */
+using ChunkQueuel = ChunkQueue_<long>;   /*!< Alias for ChunkQueue_ using long */
+using ChunkQueuef = ChunkQueue_<float>;  /*!< Alias for ChunkQueue_ using float */
+using ChunkQueued = ChunkQueue_<double>; /*!< Alias for ChunkQueue_ using double */
+using ChunkQueue = ChunkQueuei;          /*!< Alias for ChunkQueue_ using int */
+} // namespace ev
+
+#endif // OPENEV_CONTAINERS_CHUNK_QUEUE_HPP
@@ -6,10 +6,12 @@
 #ifndef OPENEV_CONTAINERS_CIRCULAR_HPP
 #define OPENEV_CONTAINERS_CIRCULAR_HPP
 
+#include "openev/containers/statistics.hpp"
 #include "openev/core/types.hpp"
 #include <boost/circular_buffer.hpp>
 #include <numeric>
 #include <opencv2/core/types.hpp>
+#include <optional>
 #include <utility>
 
 namespace ev {
@@ -18,20 +20,152 @@ namespace ev {
 
 Event circular buffers inherit all the properties from boost circular buffers. Circular buffers are fixed-size data structures in a circular fashion (i.e, the end of the buffer is reached, it wraps around to the beginning).
 */
-template <typename T>
-class CircularBuffer_ : public boost::circular_buffer<Event_<T>> {
-  using boost::circular_buffer<Event_<T>>::circular_buffer;
+template <typename T, typename Tt = double>
+class CircularBuffer_ : public boost::circular_buffer<Event_<T, Tt>> {
+  using boost::circular_buffer<Event_<T, Tt>>::circular_buffer;
 
 public:
+  /*!
+  \brief Enable or disable statistics tracking.
+
+  When enabled, running sums of the events (see RunningStatistics_) are updated by push_back(), emplace_back(), push_front(), emplace_front(), pop_back(), pop_front(), and clear(), including the events evicted when the buffer is full, so that mean(), meanPoint(), and meanTime() run in O(1). Other modifications through member functions (e.g., insert(), erase(), resize(), or assign()) invalidate the sums, which are recomputed in O(n) on the next query and kept up to date again from then on. Writing events through iterators, operator[], or a reference to the base class is not detected: call track() again after it.
+  \param enable True to enable tracking
+  */
+  inline void track(const bool enable = true) {
+    if(enable) {
+      stats_.emplace(boost::circular_buffer<Event_<T, Tt>>::begin(), boost::circular_buffer<Event_<T, Tt>>::end());
+    } else {
+      stats_.reset();
+    }
+  }
+
+  /*!
+  \brief Check if statistics tracking is enabled.
+  \return True if enabled
+  */
+  [[nodiscard]] inline bool tracking() const { return stats_.has_value(); }
+
   /*! \cond INTERNAL */
+  inline void push_back(const Event_<T, Tt> &e) {
+    if(stats_ && boost::circular_buffer<Event_<T, Tt>>::capacity() > 0) {
+      if(boost::circular_buffer<Event_<T, Tt>>::full()) {
+        stats_->remove(boost::circular_buffer<Event_<T, Tt>>::front());
+      }
+      stats_->add(e);
+    }
+    boost::circular_buffer<Event_<T, Tt>>::push_back(e);
+  }
+
   template <typename... Args>
   inline void emplace_back(Args &&...args) {
-    boost::circular_buffer<Event_<T>>::push_back(Event_<T>(std::forward<Args>(args)...));
+    push_back(Event_<T, Tt>(std::forward<Args>(args)...));
+  }
+
+  inline void push_front(const Event_<T, Tt> &e) {
+    if(stats_ && boost::circular_buffer<Event_<T, Tt>>::capacity() > 0) {
+      if(boost::circular_buffer<Event_<T, Tt>>::full()) {
+        stats_->remove(boost::circular_buffer<Event_<T, Tt>>::back());
+      }
+      stats_->add(e);
+    }
+    boost::circular_buffer<Event_<T, Tt>>::push_front(e);
   }
 
   template <typename... Args>
   inline void emplace_front(Args &&...args) {
-    boost::circular_buffer<Event_<T>>::push_front(Event_<T>(std::forward<Args>(args)...));
+    push_front(Event_<T, Tt>(std::forward<Args>(args)...));
+  }
+
+  inline void pop_back() {
+    if(stats_) {
+      stats_->remove(boost::circular_buffer<Event_<T, Tt>>::back());
+    }
+    boost::circular_buffer<Event_<T, Tt>>::pop_back();
+  }
+
+  inline void pop_front() {
+    if(stats_) {
+      stats_->remove(boost::circular_buffer<Event_<T, Tt>>::front());
+    }
+    boost::circular_buffer<Event_<T, Tt>>::pop_front();
+  }
+
+  inline void clear() {
+    if(stats_) {
+      stats_->clear();
+    }
+    boost::circular_buffer<Event_<T, Tt>>::clear();
+  }
+
+  template <typename... Args>
+  inline decltype(auto) resize(Args &&...args) {
+    invalidate();
+    return boost::circular_buffer<Event_<T, Tt>>::resize(std::forward<Args>(args)...);
+  }
+
+  template <typename... Args>
+  inline decltype(auto) rresize(Args &&...args) {
+    invalidate();
+    return boost::circular_buffer<Event_<T, Tt>>::rresize(std::forward<Args>(args)...);
+  }
+
+  template <typename... Args>
+  inline decltype(auto) insert(Args &&...args) {
+    invalidate();
+    return boost::circular_buffer<Event_<T, Tt>>::insert(std::forward<Args>(args)...);
+  }
+
+  template <typename... Args>
+  inline decltype(auto) rinsert(Args &&...args) {
+    invalidate();
+    return boost::circular_buffer<Event_<T, Tt>>::rinsert(std::forward<Args>(args)...);
+  }
+
+  template <typename... Args>
+  inline decltype(auto) erase(Args &&...args) {
+    invalidate();
+    return boost::circular_buffer<Event_<T, Tt>>::erase(std::forward<Args>(args)...);
+  }
+
+  template <typename... Args>
+  inline decltype(auto) rerase(Args &&...args) {
+    invalidate();
+    return boost::circular_buffer<Event_<T, Tt>>::rerase(std::forward<Args>(args)...);
+  }
+
+  template <typename... Args>
+  inline decltype(auto) erase_begin(Args &&...args) {
+    invalidate();
+    return boost::circular_buffer<Event_<T, Tt>>::erase_begin(std::forward<Args>(args)...);
+  }
+
+  template <typename... Args>
+  inline decltype(auto) erase_end(Args &&...args) {
+    invalidate();
+    return boost::circular_buffer<Event_<T, Tt>>::erase_end(std::forward<Args>(args)...);
+  }
+
+  template <typename... Args>
+  inline decltype(auto) assign(Args &&...args) {
+    invalidate();
+    return boost::circular_buffer<Event_<T, Tt>>::assign(std::forward<Args>(args)...);
+  }
+
+  template <typename... Args>
+  inline decltype(auto) set_capacity(Args &&...args) {
+    invalidate();
+    return boost::circular_buffer<Event_<T, Tt>>::set_capacity(std::forward<Args>(args)...);
+  }
+
+  template <typename... Args>
+  inline decltype(auto) rset_capacity(Args &&...args) {
+    invalidate();
+    return boost::circular_buffer<Event_<T, Tt>>::rset_capacity(std::forward<Args>(args)...);
+  }
+
+  inline void swap(CircularBuffer_ &other) {
+    boost::circular_buffer<Event_<T, Tt>>::swap(other);
+    std::swap(stats_, other.stats_);
   }
   /*! \endcond */
 
@@ -40,7 +174,7 @@ public:
   \return Time difference
   */
   [[nodiscard]] inline double duration() const {
-    return boost::circular_buffer<ev::Event_<T>>::back().t - boost::circular_buffer<ev::Event_<T>>::front().t;
+    return boost::circular_buffer<ev::Event_<T, Tt>>::back().t - boost::circular_buffer<ev::Event_<T, Tt>>::front().t;
   }
 
   /*!
@@ -48,7 +182,7 @@ public:
   \return Event rate
   */
   [[nodiscard]] inline double rate() const {
-    return boost::circular_buffer<ev::Event_<T>>::size() / duration();
+    return boost::circular_buffer<ev::Event_<T, Tt>>::size() / duration();
   }
 
   /*!
@@ -56,10 +190,13 @@ public:
   \return An Eventd object containing the mean values of x, y, t, and p attributes.
   */
   [[nodiscard]] inline Eventd mean() const {
-    const double x = std::accumulate(boost::circular_buffer<ev::Event_<T>>::begin(), boost::circular_buffer<ev::Event_<T>>::end(), 0.0, [](double sum, const Event_<T> &e) { return sum + e.x; }) / boost::circular_buffer<ev::Event_<T>>::size();
-    const double y = std::accumulate(boost::circular_buffer<ev::Event_<T>>::begin(), boost::circular_buffer<ev::Event_<T>>::end(), 0.0, [](double sum, const Event_<T> &e) { return sum + e.y; }) / boost::circular_buffer<ev::Event_<T>>::size();
-    const double t = std::accumulate(boost::circular_buffer<ev::Event_<T>>::begin(), boost::circular_buffer<ev::Event_<T>>::end(), 0.0, [](double sum, const Event_<T> &e) { return sum + e.t; }) / boost::circular_buffer<ev::Event_<T>>::size();
-    const double p = std::accumulate(boost::circular_buffer<ev::Event_<T>>::begin(), boost::circular_buffer<ev::Event_<T>>::end(), 0.0, [](double sum, const Event_<T> &e) { return sum + e.p; }) / boost::circular_buffer<ev::Event_<T>>::size();
+    if(stats_) {
+      return statistics().mean();
+    }
+    const double x = std::accumulate(boost::circular_buffer<ev::Event_<T, Tt>>::begin(), boost::circular_buffer<ev::Event_<T, Tt>>::end(), 0.0, [](double sum, const Event_<T, Tt> &e) { return sum + e.x; }) / boost::circular_buffer<ev::Event_<T, Tt>>::size();
+    const double y = std::accumulate(boost::circular_buffer<ev::Event_<T, Tt>>::begin(), boost::circular_buffer<ev::Event_<T, Tt>>::end(), 0.0, [](double sum, const Event_<T, Tt> &e) { return sum + e.y; }) / boost::circular_buffer<ev::Event_<T, Tt>>::size();
+    const double t = std::accumulate(boost::circular_buffer<ev::Event_<T, Tt>>::begin(), boost::circular_buffer<ev::Event_<T, Tt>>::end(), 0.0, [](double sum, const Event_<T, Tt> &e) { return sum + e.t; }) / boost::circular_buffer<ev::Event_<T, Tt>>::size();
+    const double p = std::accumulate(boost::circular_buffer<ev::Event_<T, Tt>>::begin(), boost::circular_buffer<ev::Event_<T, Tt>>::end(), 0.0, [](double sum, const Event_<T, Tt> &e) { return sum + e.p; }) / boost::circular_buffer<ev::Event_<T, Tt>>::size();
     return {x, y, t, p > 0.5};
   }
 
@@ -68,8 +205,11 @@ public:
   \return Mean point
   */
   [[nodiscard]] inline cv::Point2d meanPoint() const {
-    const double x = std::accumulate(boost::circular_buffer<ev::Event_<T>>::begin(), boost::circular_buffer<ev::Event_<T>>::end(), 0.0, [](double sum, const Event_<T> &e) { return sum + e.x; }) / boost::circular_buffer<ev::Event_<T>>::size();
-    const double y = std::accumulate(boost::circular_buffer<ev::Event_<T>>::begin(), boost::circular_buffer<ev::Event_<T>>::end(), 0.0, [](double sum, const Event_<T> &e) { return sum + e.y; }) / boost::circular_buffer<ev::Event_<T>>::size();
+    if(stats_) {
+      return statistics().meanPoint();
+    }
+    const double x = std::accumulate(boost::circular_buffer<ev::Event_<T, Tt>>::begin(), boost::circular_buffer<ev::Event_<T, Tt>>::end(), 0.0, [](double sum, const Event_<T, Tt> &e) { return sum + e.x; }) / boost::circular_buffer<ev::Event_<T, Tt>>::size();
+    const double y = std::accumulate(boost::circular_buffer<ev::Event_<T, Tt>>::begin(), boost::circular_buffer<ev::Event_<T, Tt>>::end(), 0.0, [](double sum, const Event_<T, Tt> &e) { return sum + e.y; }) / boost::circular_buffer<ev::Event_<T, Tt>>::size();
     return {x, y};
   }
 
@@ -78,7 +218,10 @@ public:
   \return Mean time
   */
   [[nodiscard]] inline double meanTime() const {
-    return std::accumulate(boost::circular_buffer<ev::Event_<T>>::begin(), boost::circular_buffer<ev::Event_<T>>::end(), 0.0, [](double sum, const Event_<T> &e) { return sum + e.t; }) / boost::circular_buffer<ev::Event_<T>>::size();
+    if(stats_) {
+      return statistics().meanTime();
+    }
+    return std::accumulate(boost::circular_buffer<ev::Event_<T, Tt>>::begin(), boost::circular_buffer<ev::Event_<T, Tt>>::end(), 0.0, [](double sum, const Event_<T, Tt> &e) { return sum + e.t; }) / boost::circular_buffer<ev::Event_<T, Tt>>::size();
   }
 
   /*!
@@ -86,8 +229,24 @@ public:
   \return Midpoint time.
   */
   [[nodiscard]] inline double midTime() const {
-    return 0.5 * (boost::circular_buffer<ev::Event_<T>>::front().t + boost::circular_buffer<ev::Event_<T>>::back().t);
+    return 0.5 * (static_cast<double>(boost::circular_buffer<ev::Event_<T, Tt>>::front().t) + static_cast<double>(boost::circular_buffer<ev::Event_<T, Tt>>::back().t));
+  }
+
+private:
+  inline void invalidate() {
+    if(stats_) {
+      stats_->invalidate();
+    }
   }
+
+  [[nodiscard]] inline const RunningStatistics_<T, Tt> &statistics() const {
+    if(!stats_->valid()) {
+      stats_->assign(boost::circular_buffer<Event_<T, Tt>>::begin(), boost::circular_buffer<Event_<T, Tt>>::end());
+    }
+    return *stats_;
+  }
+
+  mutable std::optional<RunningStatistics_<T, Tt>> stats_;
 };
 using CircularBufferi = CircularBuffer_<int>;    /*!< Alias for CircularBuffer_ using int */
 using CircularBufferl = CircularBuffer_<long>;   /*!< Alias for CircularBuffer_ using long */
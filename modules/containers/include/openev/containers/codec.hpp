@@ -0,0 +1,59 @@
+/*!
+\file codec.hpp
+\brief Encoding and decoding of raw 64-bit events into event batches and spans.
+\author Raul Tapia
+*/
+#ifndef OPENEV_CONTAINERS_CODEC_HPP
+#define OPENEV_CONTAINERS_CODEC_HPP
+
+#include "openev/containers/batch.hpp"
+#include "openev/containers/event-span.hpp"
+#include "openev/core/codec.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ev {
+namespace raw {
+/*!
+\brief Encode an event batch into the raw 64-bit layout.
+\param batch Event batch
+\param out Output buffer. It is resized to the number of events.
+\param scale Duration of one raw timestamp tick in the units of the event timestamps
+\see ev::raw::Layout
+*/
+template <typename T, typename Tt>
+inline void encode(const EventBatch_<T, Tt> &batch, std::vector<uint64_t> &out, const double scale = 1.0) {
+  out.resize(batch.size());
+  encode(batch.x().data(), batch.y().data(), batch.t().data(), batch.p().data(), batch.size(), out.data(), scale);
+}
+
+/*!
+\brief Encode a span of events (e.g., a time slice of a Vector_, see Vector_::slice_t) into the raw 64-bit layout.
+\param span Event span
+\param out Output buffer. It is resized to the number of events.
+\param scale Duration of one raw timestamp tick in the units of the event timestamps
+\see ev::raw::Layout
+*/
+template <typename T, typename Tt>
+inline void encode(const EventSpan_<T, Tt> &span, std::vector<uint64_t> &out, const double scale = 1.0) {
+  out.resize(span.size());
+  encode(span.data(), span.size(), out.data(), scale);
+}
+
+/*!
+\brief Decode a sequence of raw events and append them to an event batch.
+\param decoder Decoder
+\param data Raw events
+\param out Event batch to which the decoded events are added
+*/
+template <typename T, typename Tt>
+inline void decode(Decoder &decoder, const std::vector<uint64_t> &data, EventBatch_<T, Tt> &out) {
+  const std::size_t offset = out.size();
+  out.resize(offset + data.size());
+  decoder.decode(data.data(), data.size(), out.x().data() + offset, out.y().data() + offset, out.t().data() + offset, out.p().data() + offset);
+}
+} // namespace raw
+} // namespace ev
+
+#endif // OPENEV_CONTAINERS_CODEC_HPP
@@ -6,28 +6,153 @@
 #ifndef OPENEV_CONTAINERS_DEQUE_HPP
 #define OPENEV_CONTAINERS_DEQUE_HPP
 
+#include "openev/containers/statistics.hpp"
 #include "openev/core/types.hpp"
 #include <deque>
+#include <initializer_list>
+#include <memory>
 #include <numeric> // For std::accumulate
 #include <opencv2/core/types.hpp>
+#include <optional>
+#include <utility>
 
 namespace ev {
 /*!
 \brief This class extends std::deque to implement event deques. For more information, please refer <a href="https://en.cppreference.com/w/cpp/container/deque">here</a>.
 
-Event deques inherit all the properties from standard C++ deques. Events dequeu are double-ended queues that allows fast insertion and deletion at both its beginning and its end.
+Event deques inherit all the properties from standard C++ deques. Events dequeu are double-ended queues that allows fast insertion and deletion at both its beginning and its end. The allocator can be replaced, e.g., to take memory from an arena or a pool (see ev::pmr).
 */
-template <typename T>
-class Deque_ : public std::deque<Event_<T>> {
-  using std::deque<Event_<T>>::deque;
+template <typename T, typename Tt = double, typename Alloc = std::allocator<Event_<T, Tt>>>
+class Deque_ : public std::deque<Event_<T, Tt>, Alloc> {
+  using std::deque<Event_<T, Tt>, Alloc>::deque;
 
 public:
+  /*!
+  \brief Enable or disable statistics tracking.
+
+  When enabled, running sums of the events (see RunningStatistics_) are updated by push_back(), emplace_back(), push_front(), emplace_front(), pop_back(), pop_front(), and clear(), so that mean(), meanPoint(), and meanTime() run in O(1). Other modifications through member functions (e.g., insert(), erase(), resize(), or assign()) invalidate the sums, which are recomputed in O(n) on the next query and kept up to date again from then on. Writing events through iterators, operator[], or a reference to the base class is not detected: call track() again after it.
+  \param enable True to enable tracking
+  */
+  inline void track(const bool enable = true) {
+    if(enable) {
+      stats_.emplace(std::deque<Event_<T, Tt>, Alloc>::begin(), std::deque<Event_<T, Tt>, Alloc>::end());
+    } else {
+      stats_.reset();
+    }
+  }
+
+  /*!
+  \brief Check if statistics tracking is enabled.
+  \return True if enabled
+  */
+  [[nodiscard]] inline bool tracking() const { return stats_.has_value(); }
+
+  /*! \cond INTERNAL */
+  inline void push_back(const Event_<T, Tt> &e) {
+    if(stats_) {
+      stats_->add(e);
+    }
+    std::deque<Event_<T, Tt>, Alloc>::push_back(e);
+  }
+
+  template <typename... Args>
+  inline decltype(auto) emplace_back(Args &&...args) {
+    decltype(auto) e = std::deque<Event_<T, Tt>, Alloc>::emplace_back(std::forward<Args>(args)...);
+    if(stats_) {
+      stats_->add(e);
+    }
+    return e;
+  }
+
+  inline void push_front(const Event_<T, Tt> &e) {
+    if(stats_) {
+      stats_->add(e);
+    }
+    std::deque<Event_<T, Tt>, Alloc>::push_front(e);
+  }
+
+  template <typename... Args>
+  inline decltype(auto) emplace_front(Args &&...args) {
+    decltype(auto) e = std::deque<Event_<T, Tt>, Alloc>::emplace_front(std::forward<Args>(args)...);
+    if(stats_) {
+      stats_->add(e);
+    }
+    return e;
+  }
+
+  inline void pop_back() {
+    if(stats_) {
+      stats_->remove(std::deque<Event_<T, Tt>, Alloc>::back());
+    }
+    std::deque<Event_<T, Tt>, Alloc>::pop_back();
+  }
+
+  inline void pop_front() {
+    if(stats_) {
+      stats_->remove(std::deque<Event_<T, Tt>, Alloc>::front());
+    }
+    std::deque<Event_<T, Tt>, Alloc>::pop_front();
+  }
+
+  inline void clear() {
+    if(stats_) {
+      stats_->clear();
+    }
+    std::deque<Event_<T, Tt>, Alloc>::clear();
+  }
+
+  template <typename... Args>
+  inline decltype(auto) resize(Args &&...args) {
+    invalidate();
+    return std::deque<Event_<T, Tt>, Alloc>::resize(std::forward<Args>(args)...);
+  }
+
+  template <typename... Args>
+  inline decltype(auto) insert(Args &&...args) {
+    invalidate();
+    return std::deque<Event_<T, Tt>, Alloc>::insert(std::forward<Args>(args)...);
+  }
+
+  template <typename... Args>
+  inline decltype(auto) emplace(Args &&...args) {
+    invalidate();
+    return std::deque<Event_<T, Tt>, Alloc>::emplace(std::forward<Args>(args)...);
+  }
+
+  template <typename... Args>
+  inline decltype(auto) erase(Args &&...args) {
+    invalidate();
+    return std::deque<Event_<T, Tt>, Alloc>::erase(std::forward<Args>(args)...);
+  }
+
+  template <typename... Args>
+  inline decltype(auto) assign(Args &&...args) {
+    invalidate();
+    return std::deque<Event_<T, Tt>, Alloc>::assign(std::forward<Args>(args)...);
+  }
+
+  inline typename std::deque<Event_<T, Tt>, Alloc>::iterator insert(typename std::deque<Event_<T, Tt>, Alloc>::const_iterator pos, std::initializer_list<Event_<T, Tt>> list) {
+    invalidate();
+    return std::deque<Event_<T, Tt>, Alloc>::insert(pos, list);
+  }
+
+  inline void assign(std::initializer_list<Event_<T, Tt>> list) {
+    invalidate();
+    std::deque<Event_<T, Tt>, Alloc>::assign(list);
+  }
+
+  inline void swap(Deque_ &other) {
+    std::deque<Event_<T, Tt>, Alloc>::swap(other);
+    std::swap(stats_, other.stats_);
+  }
+  /*! \endcond */
+
   /*!
   \brief Time difference between the last and the first event.
   \return Time difference
   */
   [[nodiscard]] inline double duration() const {
-    return std::deque<ev::Event_<T>>::back().t - std::deque<ev::Event_<T>>::front().t;
+    return std::deque<Event_<T, Tt>, Alloc>::back().t - std::deque<Event_<T, Tt>, Alloc>::front().t;
   }
 
   /*!
@@ -35,7 +160,7 @@ public:
   \return Event rate
   */
   [[nodiscard]] inline double rate() const {
-    return std::deque<ev::Event_<T>>::size() / duration();
+    return std::deque<Event_<T, Tt>, Alloc>::size() / duration();
   }
 
   /*!
@@ -43,10 +168,13 @@ public:
   \return An Eventd object containing the mean values of x, y, t, and p attributes.
   */
   [[nodiscard]] inline Eventd mean() const {
-    const double x = std::accumulate(std::deque<ev::Event_<T>>::begin(), std::deque<ev::Event_<T>>::end(), 0.0, [](double sum, const Event_<T> &e) { return sum + e.x; }) / std::deque<ev::Event_<T>>::size();
-    const double y = std::accumulate(std::deque<ev::Event_<T>>::begin(), std::deque<ev::Event_<T>>::end(), 0.0, [](double sum, const Event_<T> &e) { return sum + e.y; }) / std::deque<ev::Event_<T>>::size();
-    const double t = std::accumulate(std::deque<ev::Event_<T>>::begin(), std::deque<ev::Event_<T>>::end(), 0.0, [](double sum, const Event_<T> &e) { return sum + e.t; }) / std::deque<ev::Event_<T>>::size();
-    const double p = std::accumulate(std::deque<ev::Event_<T>>::begin(), std::deque<ev::Event_<T>>::end(), 0.0, [](double sum, const Event_<T> &e) { return sum + e.p; }) / std::deque<ev::Event_<T>>::size();
+    if(stats_) {
+      return statistics().mean();
+    }
+    const double x = std::accumulate(std::deque<Event_<T, Tt>, Alloc>::begin(), std::deque<Event_<T, Tt>, Alloc>::end(), 0.0, [](double sum, const Event_<T, Tt> &e) { return sum + e.x; }) / std::deque<Event_<T, Tt>, Alloc>::size();
+    const double y = std::accumulate(std::deque<Event_<T, Tt>, Alloc>::begin(), std::deque<Event_<T, Tt>, Alloc>::end(), 0.0, [](double sum, const Event_<T, Tt> &e) { return sum + e.y; }) / std::deque<Event_<T, Tt>, Alloc>::size();
+    const double t = std::accumulate(std::deque<Event_<T, Tt>, Alloc>::begin(), std::deque<Event_<T, Tt>, Alloc>::end(), 0.0, [](double sum, const Event_<T, Tt> &e) { return sum + e.t; }) / std::deque<Event_<T, Tt>, Alloc>::size();
+    const double p = std::accumulate(std::deque<Event_<T, Tt>, Alloc>::begin(), std::deque<Event_<T, Tt>, Alloc>::end(), 0.0, [](double sum, const Event_<T, Tt> &e) { return sum + e.p; }) / std::deque<Event_<T, Tt>, Alloc>::size();
     return {x, y, t, p > 0.5};
   }
 
@@ -55,8 +183,11 @@ public:
   \return Mean point
   */
   [[nodiscard]] inline cv::Point2d meanPoint() const {
-    const double x = std::accumulate(std::deque<ev::Event_<T>>::begin(), std::deque<ev::Event_<T>>::end(), 0.0, [](double sum, const Event_<T> &e) { return sum + e.x; }) / std::deque<ev::Event_<T>>::size();
-    const double y = std::accumulate(std::deque<ev::Event_<T>>::begin(), std::deque<ev::Event_<T>>::end(), 0.0, [](double sum, const Event_<T> &e) { return sum + e.y; }) / std::deque<ev::Event_<T>>::size();
+    if(stats_) {
+      return statistics().meanPoint();
+    }
+    const double x = std::accumulate(std::deque<Event_<T, Tt>, Alloc>::begin(), std::deque<Event_<T, Tt>, Alloc>::end(), 0.0, [](double sum, const Event_<T, Tt> &e) { return sum + e.x; }) / std::deque<Event_<T, Tt>, Alloc>::size();
+    const double y = std::accumulate(std::deque<Event_<T, Tt>, Alloc>::begin(), std::deque<Event_<T, Tt>, Alloc>::end(), 0.0, [](double sum, const Event_<T, Tt> &e) { return sum + e.y; }) / std::deque<Event_<T, Tt>, Alloc>::size();
     return {x, y};
   }
 
@@ -65,7 +196,10 @@ public:
   \return Mean time
   */
   [[nodiscard]] inline double meanTime() const {
-    return std::accumulate(std::deque<ev::Event_<T>>::begin(), std::deque<ev::Event_<T>>::end(), 0.0, [](double sum, const Event_<T> &e) { return sum + e.t; }) / std::deque<ev::Event_<T>>::size();
+    if(stats_) {
+      return statistics().meanTime();
+    }
+    return std::accumulate(std::deque<Event_<T, Tt>, Alloc>::begin(), std::deque<Event_<T, Tt>, Alloc>::end(), 0.0, [](double sum, const Event_<T, Tt> &e) { return sum + e.t; }) / std::deque<Event_<T, Tt>, Alloc>::size();
   }
 
   /*!
@@ -73,8 +207,24 @@ public:
   \return Midpoint time.
   */
   [[nodiscard]] inline double midTime() const {
-    return 0.5 * (std::deque<ev::Event_<T>>::front().t + std::deque<ev::Event_<T>>::back().t);
+    return 0.5 * (static_cast<double>(std::deque<Event_<T, Tt>, Alloc>::front().t) + static_cast<double>(std::deque<Event_<T, Tt>, Alloc>::back().t));
   }
+
+private:
+  inline void invalidate() {
+    if(stats_) {
+      stats_->invalidate();
+    }
+  }
+
+  [[nodiscard]] inline const RunningStatistics_<T, Tt> &statistics() const {
+    if(!stats_->valid()) {
+      stats_->assign(std::deque<Event_<T, Tt>, Alloc>::begin(), std::deque<Event_<T, Tt>, Alloc>::end());
+    }
+    return *stats_;
+  }
+
+  mutable std::optional<RunningStatistics_<T, Tt>> stats_;
 };
 using Dequei = Deque_<int>;    /*!< Alias for Deque_ using int */
 using Dequel = Deque_<long>;   /*!< Alias for Deque_ using long */
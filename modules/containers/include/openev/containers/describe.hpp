@@ -0,0 +1,216 @@
+/*!
+\file describe.hpp
+\brief Single-pass descriptive statistics of event containers.
+\author Raul Tapia
+*/
+#ifndef OPENEV_CONTAINERS_DESCRIBE_HPP
+#define OPENEV_CONTAINERS_DESCRIBE_HPP
+
+#include "openev/core/simd.hpp"
+#include "openev/core/traits.hpp"
+#include "openev/core/types.hpp"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <opencv2/core/types.hpp>
+#include <opencv2/core/utility.hpp>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ev {
+/*!
+\brief This struct contains the descriptive statistics of a set of events computed by describe().
+
+It can be printed directly:
+\code{.cpp}
+std::cout << ev::describe(vector) << std::endl;
+\endcode
+*/
+struct Description {
+  static constexpr std::size_t MIN_EVENTS_PER_THREAD = ev::MIN_EVENTS_PER_THREAD; /*!< Minimum number of events per thread */
+
+  std::size_t size{0};  /*!< Number of events */
+  Eventd mean;          /*!< Mean of the events, as returned by the mean() method of the containers */
+  cv::Rect2d box;       /*!< Bounding box. The origin is the minimum x,y and the size is the difference between the maximum and the minimum. */
+  double tMin{0};       /*!< Minimum timestamp */
+  double tMax{0};       /*!< Maximum timestamp */
+  double ratio{0};      /*!< Fraction of positive events */
+  cv::Point2d variance; /*!< Variance of the x and y coordinates */
+
+  /*!
+  \brief Time difference between the last and the first timestamp.
+  \return Time difference
+  \note Unlike the duration() method of the containers, this does not assume that the events are sorted.
+  */
+  [[nodiscard]] inline double duration() const { return tMax - tMin; }
+
+  /*!
+  \brief Compute event rate as the ratio between the number of events and the time span.
+  \return Event rate
+  */
+  [[nodiscard]] inline double rate() const { return static_cast<double>(size) / duration(); }
+
+  /*!
+  \brief Spatial variance, i.e., the trace of the covariance matrix of the coordinates.
+  \return Spatial variance
+  */
+  [[nodiscard]] inline double spatialVariance() const { return variance.x + variance.y; }
+
+  /*!
+  \brief Overload of << operator.
+  \param os Output stream
+  \param d Description to print
+  \return Output stream
+  */
+  friend std::ostream &operator<<(std::ostream &os, const Description &d) {
+    os << "n=" << d.size << " mean=(" << d.mean.x << "," << d.mean.y << ") t=[" << d.tMin << "," << d.tMax << "] box=[" << d.box.x << "," << d.box.y << " " << d.box.width << "x" << d.box.height << "] ratio=" << d.ratio << " variance=(" << d.variance.x << "," << d.variance.y << ")";
+    return os;
+  }
+};
+
+/*! \cond INTERNAL */
+struct DescriptionMoments {
+  double n{0};
+  double x{0};
+  double y{0};
+  double xx{0};
+  double yy{0};
+  double t{0};
+  double p{0};
+  double xMin{std::numeric_limits<double>::max()};
+  double xMax{std::numeric_limits<double>::lowest()};
+  double yMin{std::numeric_limits<double>::max()};
+  double yMax{std::numeric_limits<double>::lowest()};
+  double tMin{std::numeric_limits<double>::max()};
+  double tMax{std::numeric_limits<double>::lowest()};
+
+  inline void add(const double dx, const double dy, const double dt, const double dp) {
+    n += 1;
+    x += dx;
+    y += dy;
+    xx += dx * dx;
+    yy += dy * dy;
+    t += dt;
+    p += dp;
+    xMin = dx < xMin ? dx : xMin;
+    xMax = dx > xMax ? dx : xMax;
+    yMin = dy < yMin ? dy : yMin;
+    yMax = dy > yMax ? dy : yMax;
+    tMin = dt < tMin ? dt : tMin;
+    tMax = dt > tMax ? dt : tMax;
+  }
+
+  inline DescriptionMoments &operator+=(const DescriptionMoments &m) {
+    n += m.n;
+    x += m.x;
+    y += m.y;
+    xx += m.xx;
+    yy += m.yy;
+    t += m.t;
+    p += m.p;
+    xMin = std::min(xMin, m.xMin);
+    xMax = std::max(xMax, m.xMax);
+    yMin = std::min(yMin, m.yMin);
+    yMax = std::max(yMax, m.yMax);
+    tMin = std::min(tMin, m.tMin);
+    tMax = std::max(tMax, m.tMax);
+    return *this;
+  }
+};
+
+template <typename F>
+inline DescriptionMoments describeRange(const F &at, const std::size_t begin, const std::size_t end) {
+  std::array<DescriptionMoments, simd::LANES> lanes;
+  std::size_t i = begin;
+  for(; i + simd::LANES <= end; i += simd::LANES) {
+    for(std::size_t k = 0; k < simd::LANES; k++) {
+      at(i + k, lanes[k]);
+    }
+  }
+  for(std::size_t k = 0; i < end; i++, k++) {
+    at(i, lanes[k]);
+  }
+  for(std::size_t k = 1; k < simd::LANES; k++) {
+    lanes[0] += lanes[k];
+  }
+  return lanes[0];
+}
+/*! \endcond */
+
+/*!
+\brief Compute the descriptive statistics of a set of events in a single pass.
+
+Mean, bounding box, time span, polarity ratio, and spatial variance are computed together, instead of traversing the container once per statistic. Coordinates and timestamps are accumulated relative to the first event to preserve precision.
+\param container Event container (e.g., Array_, Vector_, Deque_, CircularBuffer_, or EventBatch_)
+\param threads Number of threads. By default, the number of threads used by OpenCV.
+\return Descriptive statistics. If the container is empty, all the statistics are zero.
+\note Containers with fewer than MIN_EVENTS_PER_THREAD events per thread use fewer threads. The result does not depend on the number of threads up to floating-point rounding.
+\see Description
+*/
+template <typename Container>
+[[nodiscard]] inline Description describe(const Container &container, const int threads = 0) {
+  Description d;
+  const std::size_t n = container.size();
+  if(n == 0) {
+    return d;
+  }
+
+  double x0;
+  double y0;
+  double t0;
+  const auto run = [&](const auto &at) {
+    const int workers = static_cast<int>(std::min<std::size_t>(threads > 0 ? threads : cv::getNumThreads(), n / Description::MIN_EVENTS_PER_THREAD));
+    if(workers <= 1) {
+      return describeRange(at, 0, n);
+    }
+    std::vector<DescriptionMoments> partial(workers);
+    cv::parallel_for_(cv::Range(0, workers), [&](const cv::Range &range) {
+      for(int k = range.start; k < range.end; k++) {
+        partial[k] = describeRange(at, n * k / workers, n * (k + 1) / workers);
+      }
+    }, workers);
+    for(int k = 1; k < workers; k++) {
+      partial[0] += partial[k];
+    }
+    return partial[0];
+  };
+
+  DescriptionMoments m;
+  if constexpr(HasColumns<Container>::value) {
+    const auto *x = container.x().data();
+    const auto *y = container.y().data();
+    const auto *t = container.t().data();
+    const auto *p = container.p().data();
+    x0 = static_cast<double>(x[0]);
+    y0 = static_cast<double>(y[0]);
+    t0 = static_cast<double>(t[0]);
+    m = run([&](const std::size_t i, DescriptionMoments &lane) {
+      lane.add(static_cast<double>(x[i]) - x0, static_cast<double>(y[i]) - y0, static_cast<double>(t[i]) - t0, static_cast<double>(p[i]));
+    });
+  } else {
+    x0 = static_cast<double>(container[0].x);
+    y0 = static_cast<double>(container[0].y);
+    t0 = static_cast<double>(container[0].t);
+    m = run([&](const std::size_t i, DescriptionMoments &lane) {
+      const auto &e = container[i];
+      lane.add(static_cast<double>(e.x) - x0, static_cast<double>(e.y) - y0, static_cast<double>(e.t) - t0, static_cast<double>(e.p));
+    });
+  }
+
+  const double mx = m.x / m.n;
+  const double my = m.y / m.n;
+  d.size = n;
+  d.ratio = m.p / m.n;
+  d.mean = Eventd(x0 + mx, y0 + my, t0 + m.t / m.n, d.ratio > 0.5);
+  d.box = cv::Rect2d(x0 + m.xMin, y0 + m.yMin, m.xMax - m.xMin, m.yMax - m.yMin);
+  d.tMin = t0 + m.tMin;
+  d.tMax = t0 + m.tMax;
+  d.variance = cv::Point2d(std::max(0.0, m.xx / m.n - mx * mx), std::max(0.0, m.yy / m.n - my * my));
+  return d;
+}
+} // namespace ev
+
+#endif // OPENEV_CONTAINERS_DESCRIBE_HPP
@@ -0,0 +1,166 @@
+/*!
+\file distance.hpp
+\brief Batched distance and nearest-neighbour queries over event containers.
+\author Raul Tapia
+*/
+#ifndef OPENEV_CONTAINERS_DISTANCE_HPP
+#define OPENEV_CONTAINERS_DISTANCE_HPP
+
+#include "openev/containers/batch.hpp"
+#include "openev/core/traits.hpp"
+#include "openev/core/types.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <opencv2/core/base.hpp>
+#include <opencv2/core/mat.hpp>
+#include <opencv2/core/utils/logger.hpp>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ev {
+/*! \cond INTERNAL */
+template <uint8_t Norm, uint8_t Dims>
+struct DistanceKernel {
+  [[nodiscard]] static inline double apply(const double dx, const double dy, const double dt) {
+    if constexpr(Dims == 1) {
+      return dt;
+    } else {
+      const double dz = Dims == 3 ? dt : 0.0;
+      if constexpr(Norm == DISTANCE_NORM_INF) {
+        return std::max(std::max(std::abs(dx), std::abs(dy)), std::abs(dz));
+      } else if constexpr(Norm == DISTANCE_NORM_L1) {
+        return std::abs(dx) + std::abs(dy) + std::abs(dz);
+      } else if constexpr(Norm == DISTANCE_NORM_L2SQR) {
+        return dx * dx + dy * dy + dz * dz;
+      } else {
+        return std::sqrt(dx * dx + dy * dy + dz * dz);
+      }
+    }
+  }
+};
+
+template <uint8_t Norm, typename F>
+inline bool dispatchDistanceDims(const uint8_t type, F &&f) {
+  if(static_cast<bool>(type & DISTANCE_FLAG_SPATIOTEMPORAL)) {
+    f(DistanceKernel<Norm, 3>{});
+    return true;
+  }
+  if(static_cast<bool>(type & DISTANCE_FLAG_SPATIAL) || !static_cast<bool>(type & 0xF0U)) {
+    f(DistanceKernel<Norm, 2>{});
+    return true;
+  }
+  if(static_cast<bool>(type & DISTANCE_FLAG_TEMPORAL)) {
+    f(DistanceKernel<Norm, 1>{});
+    return true;
+  }
+  CV_LOG_ERROR(nullptr, "Bad distance option");
+  return false;
+}
+
+template <typename F>
+inline bool dispatchDistance(const uint8_t type, F &&f) {
+  if(static_cast<bool>(type & DISTANCE_FLAG_TEMPORAL) && !static_cast<bool>(type & (DISTANCE_FLAG_SPATIAL | DISTANCE_FLAG_SPATIOTEMPORAL))) {
+    return dispatchDistanceDims<DISTANCE_NORM_L2>(type, std::forward<F>(f));
+  }
+  switch(type & 0x0FU) {
+  case DISTANCE_NORM_INF:
+    return dispatchDistanceDims<DISTANCE_NORM_INF>(type, std::forward<F>(f));
+  case DISTANCE_NORM_L1:
+    return dispatchDistanceDims<DISTANCE_NORM_L1>(type, std::forward<F>(f));
+  case DISTANCE_NORM_L2:
+    return dispatchDistanceDims<DISTANCE_NORM_L2>(type, std::forward<F>(f));
+  case DISTANCE_NORM_L2SQR:
+    return dispatchDistanceDims<DISTANCE_NORM_L2SQR>(type, std::forward<F>(f));
+  default:
+    CV_LOG_ERROR(nullptr, "Bad distance option");
+    return false;
+  }
+}
+
+template <typename T, typename Tt, typename Container>
+inline void computeDistance(const Event_<T, Tt> &query, const Container &container, double *distances, const uint8_t type) {
+  const double qx = static_cast<double>(query.x);
+  const double qy = static_cast<double>(query.y);
+  const double qt = static_cast<double>(query.t);
+  const std::size_t n = container.size();
+  if(!dispatchDistance(type, [&](auto kernel) {
+       using Kernel = decltype(kernel);
+       if constexpr(HasColumns<Container>::value) {
+         const auto *x = container.x().data();
+         const auto *y = container.y().data();
+         const auto *t = container.t().data();
+         for(std::size_t i = 0; i < n; i++) {
+           distances[i] = Kernel::apply(qx - static_cast<double>(x[i]), qy - static_cast<double>(y[i]), qt - static_cast<double>(t[i]));
+         }
+       } else {
+         std::size_t i = 0;
+         for(const auto &e : container) {
+           distances[i++] = Kernel::apply(qx - static_cast<double>(e.x), qy - static_cast<double>(e.y), qt - static_cast<double>(e.t));
+         }
+       }
+     })) {
+    std::fill(distances, distances + n, 0.0);
+  }
+}
+/*! \endcond */
+
+/*!
+\brief Compute the distance between one event and every event in a container.
+\param query Query event
+\param container Event container (e.g., Vector_, Array_, Deque_, CircularBuffer_, or EventBatch_)
+\param distances Output distances. The i-th element is the distance between the query and the i-th event of the container.
+\param type Distance type
+\see Event_::distance
+\note The norm and the dimensions are resolved once per call, and the inner loop is vectorized. Coordinates and timestamps are promoted to double, so the query and the container may have different coordinate and time types, and the spatiotemporal distance is not truncated for integer coordinates.
+*/
+template <typename T, typename Tt, typename Container>
+inline void distance(const Event_<T, Tt> &query, const Container &container, std::vector<double> &distances, const uint8_t type = DISTANCE_NORM_L2 | DISTANCE_FLAG_SPATIAL) {
+  distances.resize(container.size());
+  computeDistance(query, container, distances.data(), type);
+}
+
+/*!
+\brief Compute the distance between every event in a set of queries and every event in a container.
+\param queries Query events (e.g., Vector_ or EventBatch_)
+\param container Event container (e.g., Vector_, Array_, Deque_, CircularBuffer_, or EventBatch_)
+\param distances Output distances. Element (i,j) is the distance between the i-th query and the j-th event of the container.
+\param type Distance type
+\see Event_::distance
+*/
+template <typename Queries, typename Container>
+inline void distance(const Queries &queries, const Container &container, cv::Mat_<double> &distances, const uint8_t type = DISTANCE_NORM_L2 | DISTANCE_FLAG_SPATIAL) {
+  distances.create(static_cast<int>(queries.size()), static_cast<int>(container.size()));
+  for(std::size_t i = 0; i < queries.size(); i++) {
+    computeDistance(queries[i], container, distances.template ptr<double>(static_cast<int>(i)), type);
+  }
+}
+
+/*!
+\brief Find the k nearest neighbours of an event in a container.
+\param query Query event
+\param container Event container (e.g., Vector_, Array_, Deque_, CircularBuffer_, or EventBatch_)
+\param k Number of neighbours
+\param type Distance type
+\return Indices of the k nearest events sorted by increasing distance. Ties are sorted by index. If the container has less than k events, all the indices are returned.
+\note Temporal distances are compared in absolute value.
+*/
+template <typename T, typename Tt, typename Container>
+[[nodiscard]] inline std::vector<std::size_t> knn(const Event_<T, Tt> &query, const Container &container, const std::size_t k, const uint8_t type = DISTANCE_NORM_L2 | DISTANCE_FLAG_SPATIAL) {
+  std::vector<double> d;
+  distance(query, container, d, type);
+  std::for_each(d.begin(), d.end(), [](double &v) { v = std::abs(v); });
+
+  std::vector<std::size_t> indices(d.size());
+  std::iota(indices.begin(), indices.end(), 0);
+  const std::size_t m = std::min(k, indices.size());
+  std::partial_sort(indices.begin(), indices.begin() + m, indices.end(), [&d](const std::size_t a, const std::size_t b) { return d[a] < d[b] || (d[a] == d[b] && a < b); });
+  indices.resize(m);
+  return indices;
+}
+} // namespace ev
+
+#endif // OPENEV_CONTAINERS_DISTANCE_HPP
@@ -0,0 +1,132 @@
+/*!
+\file event-span.hpp
+\brief Non-owning views over contiguous events.
+\author Raul Tapia
+*/
+#ifndef OPENEV_CONTAINERS_EVENT_SPAN_HPP
+#define OPENEV_CONTAINERS_EVENT_SPAN_HPP
+
+#include "openev/containers/span.hpp"
+#include "openev/core/types.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <opencv2/core/types.hpp>
+#include <type_traits>
+#include <utility>
+
+namespace ev {
+/*!
+\brief This class implements a read-only, non-owning view over contiguous events (e.g., a Vector_, an Array_, or part of them).
+
+Event spans do not allocate memory and can be copied cheaply. They are accepted by representations (see AbstractRepresentation_::insert), region filters (see filter()), and encoders (see raw::encode), so a time window can be processed without copying it:
+\code{.cpp}
+ev::Vector events; // sorted by timestamp
+histogram.insert(events.slice_t(t0, t1)); // O(log n), no allocation
+\endcode
+\note The viewed events must outlive the span. Time slicing assumes that the events are sorted by timestamp.
+*/
+template <typename T, typename Tt = double>
+class EventSpan_ : public Span_<const Event_<T, Tt>> {
+public:
+  using Span_<const Event_<T, Tt>>::Span_;
+
+  /*!
+  Default constructor.
+  */
+  EventSpan_() = default;
+
+  /*!
+  Constructor using a contiguous container of events.
+  \param container Container (e.g., Vector_ or Array_)
+  */
+  template <typename Container, typename = std::enable_if_t<std::is_convertible_v<decltype(std::declval<const Container &>().data()), const Event_<T, Tt> *>>>
+  EventSpan_(const Container &container) : Span_<const Event_<T, Tt>>(container.data(), container.size()) {}
+
+  /*!
+  \brief Obtain a view over the events with timestamps in [t0, t1).
+  \param t0 Initial time (included)
+  \param t1 Final time (excluded)
+  \return Event span
+  \note Complexity is logarithmic in the number of events.
+  */
+  [[nodiscard]] inline EventSpan_ slice_t(const double t0, const double t1) const {
+    const auto less = [](const Event_<T, Tt> &e, const double t) { return static_cast<double>(e.t) < t; };
+    const Event_<T, Tt> *first = std::lower_bound(this->begin(), this->end(), t0, less);
+    const Event_<T, Tt> *last = std::lower_bound(first, this->end(), std::max(t0, t1), less);
+    return {first, static_cast<std::size_t>(last - first)};
+  }
+
+  /*!
+  \brief Obtain a view over a range of events.
+  \param i Index of the first event
+  \param n Number of events
+  \return Event span. It is truncated at the end of this span.
+  */
+  [[nodiscard]] inline EventSpan_ slice_n(const std::size_t i, const std::size_t n) const {
+    const std::size_t first = std::min(i, this->size());
+    return {this->data() + first, std::min(n, this->size() - first)};
+  }
+
+  /*!
+  \brief Time difference between the last and the first event.
+  \return Time difference
+  */
+  [[nodiscard]] inline double duration() const {
+    return static_cast<double>(this->back().t) - static_cast<double>(this->front().t);
+  }
+
+  /*!
+  \brief Compute event rate as the ratio between the number of events and the time difference between the last and the first event.
+  \return Event rate
+  */
+  [[nodiscard]] inline double rate() const {
+    return this->size() / duration();
+  }
+
+  /*!
+  \brief Compute the mean of the events.
+  \return An Eventd object containing the mean values of x, y, t, and p attributes.
+  */
+  [[nodiscard]] inline Eventd mean() const {
+    const double x = std::accumulate(this->begin(), this->end(), 0.0, [](double sum, const Event_<T, Tt> &e) { return sum + e.x; }) / this->size();
+    const double y = std::accumulate(this->begin(), this->end(), 0.0, [](double sum, const Event_<T, Tt> &e) { return sum + e.y; }) / this->size();
+    const double t = std::accumulate(this->begin(), this->end(), 0.0, [](double sum, const Event_<T, Tt> &e) { return sum + e.t; }) / this->size();
+    const double p = std::accumulate(this->begin(), this->end(), 0.0, [](double sum, const Event_<T, Tt> &e) { return sum + e.p; }) / this->size();
+    return {x, y, t, p > 0.5};
+  }
+
+  /*!
+  \brief Compute the mean x,y point of the events.
+  \return Mean point
+  */
+  [[nodiscard]] inline cv::Point2d meanPoint() const {
+    const double x = std::accumulate(this->begin(), this->end(), 0.0, [](double sum, const Event_<T, Tt> &e) { return sum + e.x; }) / this->size();
+    const double y = std::accumulate(this->begin(), this->end(), 0.0, [](double sum, const Event_<T, Tt> &e) { return sum + e.y; }) / this->size();
+    return {x, y};
+  }
+
+  /*!
+  \brief Compute the mean time of the events.
+  \return Mean time
+  */
+  [[nodiscard]] inline double meanTime() const {
+    return std::accumulate(this->begin(), this->end(), 0.0, [](double sum, const Event_<T, Tt> &e) { return sum + e.t; }) / this->size();
+  }
+
+  /*!
+  \brief Calculate the midpoint time between the first and the last event.
+  \return Midpoint time.
+  */
+  [[nodiscard]] inline double midTime() const {
+    return 0.5 * (static_cast<double>(this->front().t) + static_cast<double>(this->back().t));
+  }
+};
+using EventSpani = EventSpan_<int>;    /*!< Alias for EventSpan_ using int */
+using EventSpanl = EventSpan_<long>;   /*!< Alias for EventSpan_ using long */
+using EventSpanf = EventSpan_<float>;  /*!< Alias for EventSpan_ using float */
+using EventSpand = EventSpan_<double>; /*!< Alias for EventSpan_ using double */
+using EventSpan = EventSpani;          /*!< Alias for EventSpan_ using int */
+} // namespace ev
+
+#endif // OPENEV_CONTAINERS_EVENT_SPAN_HPP
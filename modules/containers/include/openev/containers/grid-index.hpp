@@ -0,0 +1,244 @@
+/*!
+\file grid-index.hpp
+\brief Spatio-temporal grid index for event neighbourhood queries.
+\author Raul Tapia
+*/
+#ifndef OPENEV_CONTAINERS_GRID_INDEX_HPP
+#define OPENEV_CONTAINERS_GRID_INDEX_HPP
+
+#include "openev/containers/deque.hpp"
+#include "openev/containers/vector.hpp"
+#include "openev/core/types.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <opencv2/core/types.hpp>
+#include <opencv2/core/utils/logger.hpp>
+#include <type_traits>
+#include <vector>
+
+namespace ev {
+/*!
+\brief This class implements a spatio-temporal index of events.
+
+The sensor plane is divided into square cells of a given size. Each cell keeps its events ordered by time, so that neighbourhood queries only visit the cells that overlap the query region and, inside each cell, only the events within the query time interval. Queries run in O(local density) instead of O(N).
+
+Analogously to OpenCV library, the following aliases are defined for convenience:
+\code{.cpp}
+using EventGridIndexi = EventGridIndex_<int>;
+using EventGridIndexl = EventGridIndex_<long>;
+using EventGridIndexf = EventGridIndex_<float>;
+using EventGridIndexd = EventGridIndex_<double>;
+using EventGridIndex = EventGridIndexi;
+\endcode
+*/
+template <typename T, typename Tt = double>
+class EventGridIndex_ {
+public:
+  /*!
+  \brief Constructor.
+  \param size Sensor size
+  \param cell_size Side of the cells in pixels
+  */
+  EventGridIndex_(const cv::Size &size, const int cell_size) : size_{size}, cellSize_{std::max(cell_size, 1)} {
+    if(cell_size <= 0) {
+      CV_LOG_ERROR(nullptr, "EventGridIndex: Cell size must be greater than zero");
+    }
+    cols_ = (size_.width + cellSize_ - 1) / cellSize_;
+    rows_ = (size_.height + cellSize_ - 1) / cellSize_;
+    cells_.resize(static_cast<std::size_t>(cols_) * rows_);
+  }
+
+  /*!
+  \brief Insert an event.
+  \param e Event to insert
+  \return True if the event has been inserted (i.e., it lies inside the sensor)
+  \note Insertion is O(1) when events arrive in time order.
+  */
+  inline bool insert(const Event_<T, Tt> &e) {
+    if(!e.inside(cv::Rect_<T>(0, 0, static_cast<T>(size_.width), static_cast<T>(size_.height)))) {
+      return false;
+    }
+    Deque_<T, Tt> &cell = cells_[index(cellX(e.x), cellY(e.y))];
+    if(cell.empty() || !(e.t < cell.back().t)) {
+      cell.push_back(e);
+    } else {
+      cell.insert(std::upper_bound(cell.begin(), cell.end(), e), e);
+    }
+    count_++;
+    return true;
+  }
+
+  /*!
+  \brief Insert a container of events.
+  \param container Event container
+  \return Number of inserted events
+  */
+  template <typename Container>
+  inline std::size_t insert(const Container &container) {
+    std::size_t n = 0;
+    for(const auto &e : container) {
+      n += insert(e);
+    }
+    return n;
+  }
+
+  /*!
+  \brief Remove all the events older than a given time.
+  \param t Time limit. Events with timestamp lower than t are removed.
+  \return Number of removed events
+  */
+  inline std::size_t expire(const Tt t) {
+    std::size_t n = 0;
+    for(Deque_<T, Tt> &cell : cells_) {
+      while(!cell.empty() && cell.front().t < t) {
+        cell.pop_front();
+        n++;
+      }
+    }
+    count_ -= n;
+    return n;
+  }
+
+  /*!
+  \brief Get the events inside a rectangular cuboid.
+  \param rect Query region
+  \param out Vector to which the events are added
+  \return Number of events found
+  */
+  template <typename R>
+  inline std::size_t query(const Rect3_<R> &rect, Vector_<T, Tt> &out) const {
+    const Tt t0 = static_cast<Tt>(rect.t);
+    const Tt t1 = static_cast<Tt>(rect.t + rect.length);
+    return visit(static_cast<double>(rect.x), static_cast<double>(rect.y), static_cast<double>(rect.x + rect.width), static_cast<double>(rect.y + rect.height), [&](const Deque_<T, Tt> &cell) {
+      std::size_t n = 0;
+      for(auto it = lowerBound(cell, t0); it != cell.end() && it->t < t1; it++) {
+        if(rect.contains(*it)) {
+          out.push_back(*it);
+          n++;
+        }
+      }
+      return n;
+    });
+  }
+
+  /*!
+  \brief Get the events inside a circle and a time interval.
+  \param circ Query region
+  \param t0 Beginning of the time interval (inclusive)
+  \param t1 End of the time interval (inclusive)
+  \param out Vector to which the events are added
+  \return Number of events found
+  */
+  template <typename R>
+  inline std::size_t query(const Circ_<R> &circ, const Tt t0, const Tt t1, Vector_<T, Tt> &out) const {
+    const double cx = static_cast<double>(circ.center.x);
+    const double cy = static_cast<double>(circ.center.y);
+    const double r = static_cast<double>(circ.radius);
+    return visit(cx - r, cy - r, cx + r + 1, cy + r + 1, [&](const Deque_<T, Tt> &cell) {
+      std::size_t n = 0;
+      for(auto it = lowerBound(cell, t0); it != cell.end() && !(t1 < it->t); it++) {
+        if(circ.contains(*it)) {
+          out.push_back(*it);
+          n++;
+        }
+      }
+      return n;
+    });
+  }
+
+  /*!
+  \brief Get the events within a distance and a time difference of a given event.
+  \param e Query event
+  \param radius Spatial radius in pixels (inclusive)
+  \param dt Time difference (inclusive)
+  \param out Vector to which the events are added
+  \return Number of events found
+  \note The query event is included in the output if it has been inserted in the index.
+  */
+  inline std::size_t neighbours(const Event_<T, Tt> &e, const T radius, const Tt dt, Vector_<T, Tt> &out) const {
+    Tt t0;
+    if constexpr(std::is_unsigned_v<Tt>) {
+      t0 = e.t > dt ? e.t - dt : Tt{0};
+    } else {
+      t0 = e.t - dt;
+    }
+    return query(Circ_<T>(cv::Point_<T>(e.x, e.y), radius), t0, e.t + dt, out);
+  }
+
+  /*!
+  \brief Remove all events from the index.
+  */
+  inline void clear() {
+    std::for_each(cells_.begin(), cells_.end(), [](Deque_<T, Tt> &cell) { cell.clear(); });
+    count_ = 0;
+  }
+
+  /*!
+  \brief Number of events in the index.
+  \return Number of events
+  */
+  [[nodiscard]] inline std::size_t size() const { return count_; }
+
+  /*!
+  \brief Check if empty.
+  \return True if empty
+  */
+  [[nodiscard]] inline bool empty() const { return count_ == 0; }
+
+  /*!
+  \brief Grid size in cells.
+  \return Number of cells in each direction
+  */
+  [[nodiscard]] inline cv::Size grid() const { return {cols_, rows_}; }
+
+private:
+  cv::Size size_;
+  int cellSize_;
+  int cols_{0};
+  int rows_{0};
+  std::size_t count_{0};
+  std::vector<Deque_<T, Tt>> cells_;
+
+  [[nodiscard]] inline int cellX(const T x) const {
+    return std::clamp(static_cast<int>(std::floor(static_cast<double>(x) / cellSize_)), 0, cols_ - 1);
+  }
+
+  [[nodiscard]] inline int cellY(const T y) const {
+    return std::clamp(static_cast<int>(std::floor(static_cast<double>(y) / cellSize_)), 0, rows_ - 1);
+  }
+
+  [[nodiscard]] inline std::size_t index(const int cx, const int cy) const {
+    return static_cast<std::size_t>(cy) * cols_ + cx;
+  }
+
+  [[nodiscard]] static inline typename Deque_<T, Tt>::const_iterator lowerBound(const Deque_<T, Tt> &cell, const Tt t) {
+    return std::lower_bound(cell.begin(), cell.end(), t, [](const Event_<T, Tt> &e, const Tt value) { return e.t < value; });
+  }
+
+  template <typename F>
+  inline std::size_t visit(const double x0, const double y0, const double x1, const double y1, F &&f) const {
+    if(x1 <= 0 || y1 <= 0 || x0 >= size_.width || y0 >= size_.height) {
+      return 0;
+    }
+    const int cx0 = std::clamp(static_cast<int>(std::floor(x0 / cellSize_)), 0, cols_ - 1);
+    const int cy0 = std::clamp(static_cast<int>(std::floor(y0 / cellSize_)), 0, rows_ - 1);
+    const int cx1 = std::clamp(static_cast<int>(std::ceil(x1 / cellSize_)) - 1, 0, cols_ - 1);
+    const int cy1 = std::clamp(static_cast<int>(std::ceil(y1 / cellSize_)) - 1, 0, rows_ - 1);
+    std::size_t n = 0;
+    for(int cy = cy0; cy <= cy1; cy++) {
+      for(int cx = cx0; cx <= cx1; cx++) {
+        n += f(cells_[index(cx, cy)]);
+      }
+    }
+    return n;
+  }
+};
+using EventGridIndexi = EventGridIndex_<int>;    /*!< Alias for EventGridIndex_ using int */
+using EventGridIndexl = EventGridIndex_<long>;   /*!< Alias for EventGridIndex_ using long */
+using EventGridIndexf = EventGridIndex_<float>;  /*!< Alias for EventGridIndex_ using float */
+using EventGridIndexd = EventGridIndex_<double>; /*!< Alias for EventGridIndex_ using double */
+using EventGridIndex = EventGridIndexi;          /*!< Alias for EventGridIndex_ using int */
+} // namespace ev
+
+#endif // OPENEV_CONTAINERS_GRID_INDEX_HPP
@@ -0,0 +1,128 @@
+/*!
+\file packed.hpp
+\brief Vector container for packed event structures.
+\author Raul Tapia
+*/
+#ifndef OPENEV_CONTAINERS_PACKED_HPP
+#define OPENEV_CONTAINERS_PACKED_HPP
+
+#include "openev/containers/vector.hpp"
+#include "openev/core/types.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <numeric>
+#include <opencv2/core/types.hpp>
+#include <vector>
+
+namespace ev {
+/*!
+\brief This class extends std::vector to implement packed event vectors. For more information, please refer <a href="https://en.cppreference.com/w/cpp/container/vector">here</a>.
+
+Packed event vectors inherit all the properties from standard C++ vectors. Events in the vector are stored contiguously as PackedEvent (16 bytes per event), which reduces the memory traffic when large amounts of events are moved around.
+*/
+class PackedVector : public std::vector<PackedEvent> {
+  using std::vector<PackedEvent>::vector;
+
+public:
+  /*!
+  \brief Default constructor.
+  */
+  PackedVector() = default;
+
+  /*!
+  \brief Construct a packed vector from an event vector.
+  \param vector Event vector to pack
+  */
+  template <typename T, typename Tt>
+  explicit PackedVector(const Vector_<T, Tt> &vector) {
+    std::vector<PackedEvent>::reserve(vector.size());
+    std::transform(vector.begin(), vector.end(), std::back_inserter(*this), [](const Event_<T, Tt> &e) { return PackedEvent(e); });
+  }
+
+  /*!
+  \brief Unpack the events into an event vector.
+  \return Event vector
+  */
+  template <typename T = int, typename Tt = double>
+  [[nodiscard]] inline Vector_<T, Tt> unpack() const {
+    Vector_<T, Tt> vector;
+    vector.reserve(std::vector<PackedEvent>::size());
+    std::copy(std::vector<PackedEvent>::begin(), std::vector<PackedEvent>::end(), std::back_inserter(vector));
+    return vector;
+  }
+
+  /*!
+  \brief Time difference between the last and the first event.
+  \return Time difference
+  */
+  [[nodiscard]] inline double duration() const {
+    return static_cast<double>(std::vector<PackedEvent>::back().t - std::vector<PackedEvent>::front().t);
+  }
+
+  /*!
+  \brief Compute event rate as the ratio between the number of events and the time difference between the last and the first event.
+  \return Event rate
+  */
+  [[nodiscard]] inline double rate() const {
+    return std::vector<PackedEvent>::size() / duration();
+  }
+
+  /*!
+  \brief Compute the mean of the events.
+  \return An Eventd object containing the mean values of x, y, t, and p attributes.
+  */
+  [[nodiscard]] inline Eventd mean() const {
+    const double n = static_cast<double>(std::vector<PackedEvent>::size());
+    uint64_t x{0};
+    uint64_t y{0};
+    int64_t t{0};
+    uint64_t p{0};
+    for(const PackedEvent &e : *this) {
+      x += e.x;
+      y += e.y;
+      t += e.t - std::vector<PackedEvent>::front().t;
+      p += e.p;
+    }
+    return {x / n, y / n, std::vector<PackedEvent>::front().t + t / n, p / n > 0.5};
+  }
+
+  /*!
+  \brief Compute the mean x,y point of the events.
+  \return Mean point
+  */
+  [[nodiscard]] inline cv::Point2d meanPoint() const {
+    const double n = static_cast<double>(std::vector<PackedEvent>::size());
+    uint64_t x{0};
+    uint64_t y{0};
+    for(const PackedEvent &e : *this) {
+      x += e.x;
+      y += e.y;
+    }
+    return {x / n, y / n};
+  }
+
+  /*!
+  \brief Compute the mean time of the events.
+  \return Mean time
+  */
+  [[nodiscard]] inline double meanTime() const {
+    const double n = static_cast<double>(std::vector<PackedEvent>::size());
+    int64_t t{0};
+    for(const PackedEvent &e : *this) {
+      t += e.t - std::vector<PackedEvent>::front().t;
+    }
+    return std::vector<PackedEvent>::front().t + t / n;
+  }
+
+  /*!
+  \brief Calculate the midpoint time between the oldest and the newest event.
+  \return Midpoint time.
+  */
+  [[nodiscard]] inline double midTime() const {
+    return 0.5 * static_cast<double>(std::vector<PackedEvent>::front().t + std::vector<PackedEvent>::back().t);
+  }
+};
+} // namespace ev
+
+#endif // OPENEV_CONTAINERS_PACKED_HPP
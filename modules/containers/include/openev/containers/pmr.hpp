@@ -0,0 +1,65 @@
+/*!
+\file pmr.hpp
+\brief Event containers backed by memory arenas and pools.
+\author Raul Tapia
+*/
+#ifndef OPENEV_CONTAINERS_PMR_HPP
+#define OPENEV_CONTAINERS_PMR_HPP
+
+#include "openev/containers/deque.hpp"
+#include "openev/containers/queue.hpp"
+#include "openev/containers/vector.hpp"
+#include "openev/core/types.hpp"
+#include <memory_resource>
+
+namespace ev {
+/*!
+\brief Event containers that draw their memory from a memory resource (see <a href="https://en.cppreference.com/w/cpp/memory/memory_resource">here</a>).
+
+These containers are the regular Vector_, Deque_, and Queue_ with a polymorphic allocator, so they provide the same functionality. Two memory resources are provided:
+- Arena: a monotonic buffer. Allocations only bump a pointer and deallocations are no-ops; all the memory is released at once with release(). If the arena is built on a preallocated buffer, release() rewinds to that buffer, so a per-frame loop does not allocate from the heap.
+- Pool: a pool of recycled blocks. Deallocated blocks are kept and reused by later allocations of the same size, so containers that allocate and free blocks continuously (e.g., Deque_ and Queue_) do not allocate from the heap once the pool is warm.
+
+\code{.cpp}
+ev::pmr::Pool pool;
+ev::pmr::Deque deque(&pool);
+while(reader.read(e)) {
+  deque.push_back(e); // Blocks are taken from the pool
+  if(deque.size() > 1000) {
+    deque.pop_front(); // Blocks are given back to the pool
+  }
+}
+\endcode
+\note Memory resources must outlive the containers that use them. Arena and Pool are not thread-safe.
+*/
+namespace pmr {
+using Arena = std::pmr::monotonic_buffer_resource;   /*!< Monotonic memory arena */
+using Pool = std::pmr::unsynchronized_pool_resource; /*!< Pool of recycled memory blocks */
+
+template <typename T, typename Tt = double>
+using Vector_ = ev::Vector_<T, Tt, std::pmr::polymorphic_allocator<Event_<T, Tt>>>; /*!< Vector_ using a memory resource */
+using Vectori = Vector_<int>;                                                      /*!< Alias for pmr::Vector_ using int */
+using Vectorl = Vector_<long>;                                                     /*!< Alias for pmr::Vector_ using long */
+using Vectorf = Vector_<float>;                                                    /*!< Alias for pmr::Vector_ using float */
+using Vectord = Vector_<double>;                                                   /*!< Alias for pmr::Vector_ using double */
+using Vector = Vectori;                                                            /*!< Alias for pmr::Vector_ using int */
+
+template <typename T, typename Tt = double>
+using Deque_ = ev::Deque_<T, Tt, std::pmr::polymorphic_allocator<Event_<T, Tt>>>; /*!< Deque_ using a memory resource */
+using Dequei = Deque_<int>;                                                      /*!< Alias for pmr::Deque_ using int */
+using Dequel = Deque_<long>;                                                     /*!< Alias for pmr::Deque_ using long */
+using Dequef = Deque_<float>;                                                    /*!< Alias for pmr::Deque_ using float */
+using Dequed = Deque_<double>;                                                   /*!< Alias for pmr::Deque_ using double */
+using Deque = Dequei;                                                            /*!< Alias for pmr::Deque_ using int */
+
+template <typename T, typename Tt = double>
+using Queue_ = ev::Queue_<T, Tt, std::pmr::polymorphic_allocator<Event_<T, Tt>>>; /*!< Queue_ using a memory resource */
+using Queuei = Queue_<int>;                                                      /*!< Alias for pmr::Queue_ using int */
+using Queuel = Queue_<long>;                                                     /*!< Alias for pmr::Queue_ using long */
+using Queuef = Queue_<float>;                                                    /*!< Alias for pmr::Queue_ using float */
+using Queued = Queue_<double>;                                                   /*!< Alias for pmr::Queue_ using double */
+using Queue = Queuei;                                                            /*!< Alias for pmr::Queue_ using int */
+} // namespace pmr
+} // namespace ev
+
+#endif // OPENEV_CONTAINERS_PMR_HPP
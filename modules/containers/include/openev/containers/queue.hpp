@@ -8,6 +8,8 @@
 
 #include "openev/core/types.hpp"
 #include <cstddef>
+#include <deque>
+#include <memory>
 #include <opencv2/core/types.hpp>
 #include <queue>
 
@@ -15,11 +17,11 @@ namespace ev {
 /*!
 \brief This class extends std::queue to implement event queues. For more information, please refer <a href="https://en.cppreference.com/w/cpp/container/queue">here</a>.
 
-Event queues inherit all the properties from standard C++ queues. Events queues are FIFO data structures not intended to be directly iterated.
+Event queues inherit all the properties from standard C++ queues. Events queues are FIFO data structures not intended to be directly iterated. The allocator can be replaced, e.g., to take memory from an arena or a pool (see ev::pmr).
 */
-template <typename T>
-class Queue_ : public std::queue<Event_<T>> {
-  using std::queue<Event_<T>>::queue;
+template <typename T, typename Tt = double, typename Alloc = std::allocator<Event_<T, Tt>>>
+class Queue_ : public std::queue<Event_<T, Tt>, std::deque<Event_<T, Tt>, Alloc>> {
+  using std::queue<Event_<T, Tt>, std::deque<Event_<T, Tt>, Alloc>>::queue;
 
 public:
   /*!
@@ -27,7 +29,7 @@ public:
   \return Time difference
   */
   [[nodiscard]] inline double duration() const {
-    return std::queue<ev::Event_<T>>::back().t - std::queue<ev::Event_<T>>::front().t;
+    return std::queue<Event_<T, Tt>, std::deque<Event_<T, Tt>, Alloc>>::back().t - std::queue<Event_<T, Tt>, std::deque<Event_<T, Tt>, Alloc>>::front().t;
   }
 
   /*!
@@ -35,7 +37,7 @@ public:
   \return Event rate
   */
   [[nodiscard]] inline double rate() const {
-    return std::queue<ev::Event_<T>>::size() / duration();
+    return std::queue<Event_<T, Tt>, std::deque<Event_<T, Tt>, Alloc>>::size() / duration();
   }
 
   /*!
@@ -43,19 +45,19 @@ public:
   \return An Eventd object containing the mean values of x, y, t, and p attributes.
   */
   [[nodiscard]] inline Eventd mean() {
-    const std::size_t n = std::queue<ev::Event_<T>>::size();
+    const std::size_t n = std::queue<Event_<T, Tt>, std::deque<Event_<T, Tt>, Alloc>>::size();
     double x{0};
     double y{0};
     double t{0};
     double p{0};
 
-    while(!std::queue<ev::Event_<T>>::empty()) {
-      const Event_<T> &e = std::queue<ev::Event_<T>>::front();
+    while(!std::queue<Event_<T, Tt>, std::deque<Event_<T, Tt>, Alloc>>::empty()) {
+      const Event_<T, Tt> &e = std::queue<Event_<T, Tt>, std::deque<Event_<T, Tt>, Alloc>>::front();
       x += e.x;
       y += e.y;
       t += e.t;
       p += e.p;
-      std::queue<ev::Event_<T>>::pop();
+      std::queue<Event_<T, Tt>, std::deque<Event_<T, Tt>, Alloc>>::pop();
     }
 
     return {x / n, y / n, t / n, p / n > 0.5};
@@ -66,15 +68,15 @@ public:
   \return Mean point
   */
   [[nodiscard]] inline cv::Point2d meanPoint() {
-    const std::size_t n = std::queue<ev::Event_<T>>::size();
+    const std::size_t n = std::queue<Event_<T, Tt>, std::deque<Event_<T, Tt>, Alloc>>::size();
     double x{0};
     double y{0};
 
-    while(!std::queue<ev::Event_<T>>::empty()) {
-      const Event_<T> &e = std::queue<ev::Event_<T>>::front();
+    while(!std::queue<Event_<T, Tt>, std::deque<Event_<T, Tt>, Alloc>>::empty()) {
+      const Event_<T, Tt> &e = std::queue<Event_<T, Tt>, std::deque<Event_<T, Tt>, Alloc>>::front();
       x += e.x;
       y += e.y;
-      std::queue<ev::Event_<T>>::pop();
+      std::queue<Event_<T, Tt>, std::deque<Event_<T, Tt>, Alloc>>::pop();
     }
 
     return {x / n, y / n};
@@ -85,12 +87,12 @@ public:
   \return Mean time
   */
   [[nodiscard]] inline double meanTime() {
-    const std::size_t n = std::queue<ev::Event_<T>>::size();
+    const std::size_t n = std::queue<Event_<T, Tt>, std::deque<Event_<T, Tt>, Alloc>>::size();
     double t{0};
 
-    while(!std::queue<ev::Event_<T>>::empty()) {
-      t += std::queue<ev::Event_<T>>::front().t;
-      std::queue<ev::Event_<T>>::pop();
+    while(!std::queue<Event_<T, Tt>, std::deque<Event_<T, Tt>, Alloc>>::empty()) {
+      t += std::queue<Event_<T, Tt>, std::deque<Event_<T, Tt>, Alloc>>::front().t;
+      std::queue<Event_<T, Tt>, std::deque<Event_<T, Tt>, Alloc>>::pop();
     }
 
     return t / n;
@@ -101,7 +103,7 @@ public:
   \return Midpoint time.
   */
   [[nodiscard]] inline double midTime() const {
-    return 0.5 * (std::queue<ev::Event_<T>>::front().t + std::queue<ev::Event_<T>>::back().t);
+    return 0.5 * (static_cast<double>(std::queue<Event_<T, Tt>, std::deque<Event_<T, Tt>, Alloc>>::front().t) + static_cast<double>(std::queue<Event_<T, Tt>, std::deque<Event_<T, Tt>, Alloc>>::back().t));
   }
 };
 using Queuei = Queue_<int>;    /*!< Alias for Queue_ using int */
@@ -0,0 +1,286 @@
+/*!
+\file region.hpp
+\brief Bulk region filtering over event containers.
+\author Raul Tapia
+*/
+#ifndef OPENEV_CONTAINERS_REGION_HPP
+#define OPENEV_CONTAINERS_REGION_HPP
+
+#include "openev/containers/batch.hpp"
+#include "openev/containers/event-span.hpp"
+#include "openev/containers/vector.hpp"
+#include "openev/core/roi.hpp"
+#include "openev/core/types.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <opencv2/core/types.hpp>
+#include <type_traits>
+#include <vector>
+
+namespace ev {
+/*!
+\brief This class defines the union of two regions.
+
+Regions can be Rect2_, Rect3_, Circ_, MaskROI, or nested unions and intersections. Unions are usually created with ev::unite.
+*/
+template <typename A, typename B>
+struct RegionUnion_ {
+  A a; /*!< First region */
+  B b; /*!< Second region */
+
+  /*!
+  \brief Check if the union contains an event.
+  \param e Event to check
+  \return True if the event is inside any of the regions
+  */
+  template <typename Te, typename Tt>
+  [[nodiscard]] inline bool contains(const Event_<Te, Tt> &e) const {
+    return a.contains(e) || b.contains(e);
+  }
+};
+
+/*!
+\brief This class defines the intersection of two regions.
+
+Regions can be Rect2_, Rect3_, Circ_, MaskROI, or nested unions and intersections. Intersections are usually created with ev::intersect.
+*/
+template <typename A, typename B>
+struct RegionIntersection_ {
+  A a; /*!< First region */
+  B b; /*!< Second region */
+
+  /*!
+  \brief Check if the intersection contains an event.
+  \param e Event to check
+  \return True if the event is inside both regions
+  */
+  template <typename Te, typename Tt>
+  [[nodiscard]] inline bool contains(const Event_<Te, Tt> &e) const {
+    return a.contains(e) && b.contains(e);
+  }
+};
+
+/*!
+\brief Create the union of two regions.
+\param a First region
+\param b Second region
+\return Union
+*/
+template <typename A, typename B>
+[[nodiscard]] inline RegionUnion_<A, B> unite(const A &a, const B &b) {
+  return {a, b};
+}
+
+/*!
+\brief Create the intersection of two regions.
+\param a First region
+\param b Second region
+\return Intersection
+*/
+template <typename A, typename B>
+[[nodiscard]] inline RegionIntersection_<A, B> intersect(const A &a, const B &b) {
+  return {a, b};
+}
+
+/*! \cond INTERNAL */
+template <typename Region>
+struct RegionKernel;
+
+template <typename R>
+struct RegionKernel<cv::Rect_<R>> {
+  double x0, x1, y0, y1;
+  explicit RegionKernel(const cv::Rect_<R> &r) : x0{static_cast<double>(r.x)}, x1{static_cast<double>(r.x + r.width)}, y0{static_cast<double>(r.y)}, y1{static_cast<double>(r.y + r.height)} {}
+  [[nodiscard]] inline bool operator()(const double x, const double y, const double /*t*/) const {
+    return static_cast<bool>(static_cast<int>(x >= x0) & static_cast<int>(x < x1) & static_cast<int>(y >= y0) & static_cast<int>(y < y1));
+  }
+};
+
+template <typename R>
+struct RegionKernel<Rect3_<R>> {
+  RegionKernel<cv::Rect_<R>> rect;
+  double t0, t1;
+  explicit RegionKernel(const Rect3_<R> &r) : rect{r}, t0{static_cast<double>(r.t)}, t1{static_cast<double>(r.t + r.length)} {}
+  [[nodiscard]] inline bool operator()(const double x, const double y, const double t) const {
+    return static_cast<bool>(static_cast<int>(rect(x, y, t)) & static_cast<int>(t >= t0) & static_cast<int>(t < t1));
+  }
+};
+
+template <typename R>
+struct RegionKernel<Circ_<R>> {
+  double cx, cy, r2;
+  explicit RegionKernel(const Circ_<R> &c) : cx{static_cast<double>(c.center.x)}, cy{static_cast<double>(c.center.y)}, r2{c.empty() ? -1.0 : static_cast<double>(c.radius) * static_cast<double>(c.radius)} {}
+  [[nodiscard]] inline bool operator()(const double x, const double y, const double /*t*/) const {
+    return (x - cx) * (x - cx) + (y - cy) * (y - cy) <= r2;
+  }
+};
+
+template <>
+struct RegionKernel<MaskROI> {
+  const MaskROI *roi;
+  explicit RegionKernel(const MaskROI &r) : roi{&r} {}
+  [[nodiscard]] inline bool operator()(const double x, const double y, const double /*t*/) const {
+    return roi->contains(static_cast<int>(std::floor(x + 0.5)), static_cast<int>(std::floor(y + 0.5)));
+  }
+};
+
+template <typename A, typename B>
+struct RegionKernel<RegionUnion_<A, B>> {
+  RegionKernel<A> a;
+  RegionKernel<B> b;
+  explicit RegionKernel(const RegionUnion_<A, B> &r) : a{r.a}, b{r.b} {}
+  [[nodiscard]] inline bool operator()(const double x, const double y, const double t) const {
+    return static_cast<bool>(static_cast<int>(a(x, y, t)) | static_cast<int>(b(x, y, t)));
+  }
+};
+
+template <typename A, typename B>
+struct RegionKernel<RegionIntersection_<A, B>> {
+  RegionKernel<A> a;
+  RegionKernel<B> b;
+  explicit RegionKernel(const RegionIntersection_<A, B> &r) : a{r.a}, b{r.b} {}
+  [[nodiscard]] inline bool operator()(const double x, const double y, const double t) const {
+    return static_cast<bool>(static_cast<int>(a(x, y, t)) & static_cast<int>(b(x, y, t)));
+  }
+};
+
+template <typename Container>
+struct RegionOutput {
+  using type = Vector_<decltype(Container::value_type::x), decltype(Container::value_type::t)>;
+};
+
+template <typename T, typename Tt>
+struct RegionOutput<EventSpan_<T, Tt>> {
+  using type = Vector_<T, Tt>;
+};
+
+template <typename T, typename Tt>
+struct RegionOutput<EventBatch_<T, Tt>> {
+  using type = EventBatch_<T, Tt>;
+};
+
+template <typename Region, typename Container>
+inline void evaluate(const Region &region, const Container &container, uint8_t *keep) {
+  const RegionKernel<Region> kernel(region);
+  std::size_t i = 0;
+  for(const auto &e : container) {
+    keep[i++] = kernel(static_cast<double>(e.x), static_cast<double>(e.y), static_cast<double>(e.t));
+  }
+}
+
+template <typename Region, typename T, typename Tt>
+inline void evaluate(const Region &region, const EventBatch_<T, Tt> &batch, uint8_t *keep) {
+  const RegionKernel<Region> kernel(region);
+  const T *x = batch.x().data();
+  const T *y = batch.y().data();
+  const Tt *t = batch.t().data();
+  const std::size_t n = batch.size();
+  for(std::size_t i = 0; i < n; i++) {
+    keep[i] = kernel(static_cast<double>(x[i]), static_cast<double>(y[i]), static_cast<double>(t[i]));
+  }
+}
+
+template <typename Container, typename Output>
+inline void compact(const Container &container, const uint8_t *keep, Output &out) {
+  const std::size_t count = std::accumulate(keep, keep + container.size(), std::size_t{0});
+  out.resize(count + 1);
+  std::size_t i = 0;
+  std::size_t j = 0;
+  for(const auto &e : container) {
+    out[j] = e;
+    j += keep[i++];
+  }
+  out.resize(count);
+}
+
+template <typename T, typename Tt>
+inline void compact(const EventBatch_<T, Tt> &batch, const uint8_t *keep, EventBatch_<T, Tt> &out) {
+  const std::size_t n = batch.size();
+  const std::size_t count = std::accumulate(keep, keep + n, std::size_t{0});
+  out.resize(count + 1);
+  const T *x = batch.x().data();
+  const T *y = batch.y().data();
+  const Tt *t = batch.t().data();
+  const uint8_t *p = batch.p().data();
+  T *ox = out.x().data();
+  T *oy = out.y().data();
+  Tt *ot = out.t().data();
+  uint8_t *op = out.p().data();
+  std::size_t j = 0;
+  for(std::size_t i = 0; i < n; i++) {
+    ox[j] = x[i];
+    oy[j] = y[i];
+    ot[j] = t[i];
+    op[j] = p[i];
+    j += keep[i];
+  }
+  out.resize(count);
+}
+/*! \endcond */
+
+/*!
+\brief Compute a bitmask with the events of a container that lie inside a region.
+\param region Region (Rect2_, Rect3_, Circ_, MaskROI, or a union/intersection of them)
+\param container Event container (e.g., Vector_, Array_, EventSpan_, or EventBatch_)
+\param bits Output bitmask. Bit i%64 of word i/64 is set if the i-th event is inside the region.
+\note Regions are evaluated with branch-free arithmetic in double precision, except MaskROI, which is a table lookup. Rect2_, Circ_, and MaskROI do not constrain time.
+*/
+template <typename Region, typename Container>
+inline void mask(const Region &region, const Container &container, std::vector<uint64_t> &bits) {
+  const std::size_t n = container.size();
+  std::vector<uint8_t> keep(n);
+  evaluate(region, container, keep.data());
+  bits.assign((n + 63) / 64, 0);
+  for(std::size_t i = 0; i < n; i++) {
+    bits[i / 64] |= static_cast<uint64_t>(keep[i]) << (i % 64);
+  }
+}
+
+/*!
+\brief Copy the events of a container that lie inside a region.
+\param region Region (Rect2_, Rect3_, Circ_, MaskROI, or a union/intersection of them)
+\param container Event container (e.g., Vector_, Array_, EventSpan_, or EventBatch_)
+\param out Output container. Its memory is reused across calls.
+\note Relative order of the events is preserved.
+*/
+template <typename Region, typename Container>
+inline void filter(const Region &region, const Container &container, typename RegionOutput<Container>::type &out) {
+  std::vector<uint8_t> keep(container.size());
+  evaluate(region, container, keep.data());
+  compact(container, keep.data(), out);
+}
+
+/*!
+\brief Copy the events of a container that lie inside a region.
+\param region Region (Rect2_, Rect3_, Circ_, MaskROI, or a union/intersection of them)
+\param container Event container (e.g., Vector_, Array_, EventSpan_, or EventBatch_)
+\return Events inside the region. Vector_ is returned for AoS containers and EventBatch_ for event batches.
+*/
+template <typename Region, typename Container>
+[[nodiscard]] inline typename RegionOutput<Container>::type filter(const Region &region, const Container &container) {
+  typename RegionOutput<Container>::type out;
+  filter(region, container, out);
+  return out;
+}
+
+/*!
+\brief Split the events of a container into those inside and outside a region.
+\param region Region (Rect2_, Rect3_, Circ_, MaskROI, or a union/intersection of them)
+\param container Event container (e.g., Vector_, Array_, EventSpan_, or EventBatch_)
+\param inside Output container with the events inside the region
+\param outside Output container with the events outside the region
+\note Relative order of the events is preserved in both outputs.
+*/
+template <typename Region, typename Container>
+inline void partition(const Region &region, const Container &container, typename RegionOutput<Container>::type &inside, typename RegionOutput<Container>::type &outside) {
+  std::vector<uint8_t> keep(container.size());
+  evaluate(region, container, keep.data());
+  compact(container, keep.data(), inside);
+  std::for_each(keep.begin(), keep.end(), [](uint8_t &k) { k ^= 1U; });
+  compact(container, keep.data(), outside);
+}
+} // namespace ev
+
+#endif // OPENEV_CONTAINERS_REGION_HPP
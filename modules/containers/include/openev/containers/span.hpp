@@ -0,0 +1,101 @@
+/*!
+\file span.hpp
+\brief Non-owning views over contiguous data.
+\author Raul Tapia
+*/
+#ifndef OPENEV_CONTAINERS_SPAN_HPP
+#define OPENEV_CONTAINERS_SPAN_HPP
+
+#include <cstddef>
+
+namespace ev {
+/*!
+\brief This class implements a non-owning view over a contiguous sequence of elements, analogous to C++20 std::span.
+
+Spans do not allocate memory and can be copied cheaply. The viewed data must outlive the span.
+*/
+template <typename T>
+class Span_ {
+public:
+  using value_type = T;          /*!< Element type */
+  using iterator = T *;          /*!< Iterator type */
+  using size_type = std::size_t; /*!< Size type */
+
+  /*!
+  Default constructor.
+  */
+  Span_() = default;
+
+  /*!
+  Constructor using pointer and size.
+  \param data Pointer to the first element
+  \param size Number of elements
+  */
+  Span_(T *data, const std::size_t size) : data_{data}, size_{size} {};
+
+  /*!
+  \brief Pointer to the first element.
+  \return Pointer
+  */
+  [[nodiscard]] inline T *data() const { return data_; }
+
+  /*!
+  \brief Number of elements in the span.
+  \return Size
+  */
+  [[nodiscard]] inline std::size_t size() const { return size_; }
+
+  /*!
+  \brief Check if empty.
+  \return True if empty
+  */
+  [[nodiscard]] inline bool empty() const { return size_ == 0; }
+
+  /*!
+  \brief Access element.
+  \param i Index
+  \return Reference to the element
+  */
+  [[nodiscard]] inline T &operator[](const std::size_t i) const { return data_[i]; }
+
+  /*!
+  \brief Access first element.
+  \return Reference to the element
+  */
+  [[nodiscard]] inline T &front() const { return data_[0]; }
+
+  /*!
+  \brief Access last element.
+  \return Reference to the element
+  */
+  [[nodiscard]] inline T &back() const { return data_[size_ - 1]; }
+
+  /*!
+  \brief Iterator to the first element.
+  \return Iterator
+  */
+  [[nodiscard]] inline T *begin() const { return data_; }
+
+  /*!
+  \brief Iterator past the last element.
+  \return Iterator
+  */
+  [[nodiscard]] inline T *end() const { return data_ + size_; }
+
+  /*!
+  \brief Obtain a view over a subsequence.
+  \param offset Index of the first element
+  \param count Number of elements
+  \return Span
+  */
+  [[nodiscard]] inline Span_<T> subspan(const std::size_t offset, const std::size_t count) const {
+    return {data_ + offset, count};
+  }
+
+private:
+  T *data_{nullptr};
+  std::size_t size_{0};
+};
+} // namespace ev
+
+#endif // OPENEV_CONTAINERS_SPAN_HPP
@@ -0,0 +1,277 @@
+/*!
+\file spsc-ring.hpp
+\brief Lock-free single-producer/single-consumer ring of events.
+\author Raul Tapia
+*/
+#ifndef OPENEV_CONTAINERS_SPSC_RING_HPP
+#define OPENEV_CONTAINERS_SPSC_RING_HPP
+
+#include "openev/core/types.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <opencv2/core/types.hpp>
+#include <utility>
+#include <vector>
+
+namespace ev {
+/*!
+\brief This class implements a fixed-capacity, wait-free ring of events shared by exactly one producer thread and one consumer thread.
+
+The producer calls push(), emplace(), and push_n(); the consumer calls pop(), pop_n(), and the read-only helpers (e.g., front(), mean(), or duration()). No operation blocks or retries: if the ring is full (empty), push (pop) operations return immediately and report how many events were transferred.
+
+The producer and consumer indices live in different cache lines, and each side keeps a private copy of the other side's index, which is only refreshed when the ring looks full (empty). Hence, in steady state, each side only touches its own cache line.
+\code{.cpp}
+ev::SpscRing ring(1 << 16);
+std::thread producer([&]() { ring.push_n(events.begin(), events.size()); });
+ev::Vector out(events.size());
+std::size_t n = 0;
+while(n < out.size()) {
+  n += ring.pop_n(out.begin() + n, out.size() - n);
+}
+\endcode
+\note The capacity is rounded up to the next power of two.
+\warning Using more than one producer or more than one consumer is undefined behaviour.
+*/
+template <typename T, typename Tt = double>
+class SpscRing_ {
+public:
+  static constexpr std::size_t CACHE_LINE = 64; /*!< Size of a cache line in bytes */
+
+  /*!
+  \brief Constructor.
+  \param capacity Minimum number of events that the ring can hold
+  */
+  explicit SpscRing_(const std::size_t capacity) {
+    std::size_t n = 1;
+    while(n < capacity) {
+      n <<= 1;
+    }
+    slots_.resize(n);
+    mask_ = n - 1;
+  }
+
+  /*!
+  \brief Maximum number of events.
+  \return Capacity
+  */
+  [[nodiscard]] inline std::size_t capacity() const { return mask_ + 1; }
+
+  /*!
+  \brief Number of events in the ring.
+  \return Number of events
+  \note If called concurrently with the producer or the consumer, the result is a snapshot that may be outdated.
+  */
+  [[nodiscard]] inline std::size_t size() const {
+    const std::size_t head = head_.load(std::memory_order_acquire);
+    return tail_.load(std::memory_order_acquire) - head;
+  }
+
+  /*!
+  \brief Check if the ring is empty.
+  \return True if empty
+  */
+  [[nodiscard]] inline bool empty() const { return size() == 0; }
+
+  /*!
+  \brief Insert an event (producer).
+  \param e Event
+  \return False if the ring is full
+  */
+  inline bool push(const Event_<T, Tt> &e) {
+    const std::size_t tail = tail_.load(std::memory_order_relaxed);
+    if(tail - headCache_ > mask_) {
+      headCache_ = head_.load(std::memory_order_acquire);
+      if(tail - headCache_ > mask_) {
+        return false;
+      }
+    }
+    slots_[tail & mask_] = e;
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  /*!
+  \brief Construct and insert an event (producer).
+  \param args Arguments of the event constructor
+  \return False if the ring is full
+  */
+  template <typename... Args>
+  inline bool emplace(Args &&...args) {
+    return push(Event_<T, Tt>(std::forward<Args>(args)...));
+  }
+
+  /*!
+  \brief Insert several events at once (producer).
+  \param first Iterator to the first event
+  \param n Number of events
+  \return Number of events inserted, which is smaller than n if the ring fills up
+  */
+  template <typename It>
+  inline std::size_t push_n(It first, const std::size_t n) {
+    const std::size_t tail = tail_.load(std::memory_order_relaxed);
+    if(capacity() - (tail - headCache_) < n) {
+      headCache_ = head_.load(std::memory_order_acquire);
+    }
+    const std::size_t k = std::min(n, capacity() - (tail - headCache_));
+    const std::size_t offset = tail & mask_;
+    const std::size_t a = std::min(k, capacity() - offset);
+    std::copy_n(first, a, slots_.begin() + offset);
+    std::copy_n(std::next(first, a), k - a, slots_.begin());
+    tail_.store(tail + k, std::memory_order_release);
+    return k;
+  }
+
+  /*!
+  \brief Extract the oldest event (consumer).
+  \param e Output event
+  \return False if the ring is empty
+  */
+  inline bool pop(Event_<T, Tt> &e) {
+    const std::size_t head = head_.load(std::memory_order_relaxed);
+    if(head == tailCache_) {
+      tailCache_ = tail_.load(std::memory_order_acquire);
+      if(head == tailCache_) {
+        return false;
+      }
+    }
+    e = slots_[head & mask_];
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  /*!
+  \brief Extract several events at once (consumer).
+  \param out Output iterator
+  \param n Maximum number of events
+  \return Number of events extracted, which is smaller than n if the ring empties
+  */
+  template <typename It>
+  inline std::size_t pop_n(It out, const std::size_t n) {
+    const std::size_t head = head_.load(std::memory_order_relaxed);
+    if(tailCache_ - head < n) {
+      tailCache_ = tail_.load(std::memory_order_acquire);
+    }
+    const std::size_t k = std::min(n, tailCache_ - head);
+    const std::size_t offset = head & mask_;
+    const std::size_t a = std::min(k, capacity() - offset);
+    out = std::copy_n(slots_.begin() + offset, a, out);
+    std::copy_n(slots_.begin(), k - a, out);
+    head_.store(head + k, std::memory_order_release);
+    return k;
+  }
+
+  /*!
+  \brief Access the i-th oldest event (consumer).
+  \param i Index, which must be smaller than size()
+  \return Event
+  */
+  [[nodiscard]] inline const Event_<T, Tt> &operator[](const std::size_t i) const {
+    return slots_[(head_.load(std::memory_order_relaxed) + i) & mask_];
+  }
+
+  /*!
+  \brief Access the oldest event (consumer).
+  \return Oldest event
+  */
+  [[nodiscard]] inline const Event_<T, Tt> &front() const { return (*this)[0]; }
+
+  /*!
+  \brief Access the newest event (consumer).
+  \return Newest event
+  */
+  [[nodiscard]] inline const Event_<T, Tt> &back() const { return (*this)[size() - 1]; }
+
+  /*!
+  \brief Time difference between the newest and the oldest event (consumer).
+  \return Time difference
+  */
+  [[nodiscard]] inline double duration() const {
+    return static_cast<double>(back().t) - static_cast<double>(front().t);
+  }
+
+  /*!
+  \brief Compute event rate as the ratio between the number of events and the time difference between the newest and the oldest event (consumer).
+  \return Event rate
+  */
+  [[nodiscard]] inline double rate() const {
+    return size() / duration();
+  }
+
+  /*!
+  \brief Compute the mean of the events (consumer).
+  \return An Eventd object containing the mean values of x, y, t, and p attributes.
+  */
+  [[nodiscard]] inline Eventd mean() const {
+    double x{0};
+    double y{0};
+    double t{0};
+    double p{0};
+    const std::size_t n = accumulate([&](const Event_<T, Tt> &e) {
+      x += e.x;
+      y += e.y;
+      t += e.t;
+      p += e.p;
+    });
+    return {x / n, y / n, t / n, p / n > 0.5};
+  }
+
+  /*!
+  \brief Compute the mean x,y point of the events (consumer).
+  \return Mean point
+  */
+  [[nodiscard]] inline cv::Point2d meanPoint() const {
+    double x{0};
+    double y{0};
+    const std::size_t n = accumulate([&](const Event_<T, Tt> &e) {
+      x += e.x;
+      y += e.y;
+    });
+    return {x / n, y / n};
+  }
+
+  /*!
+  \brief Compute the mean time of the events (consumer).
+  \return Mean time
+  */
+  [[nodiscard]] inline double meanTime() const {
+    double t{0};
+    const std::size_t n = accumulate([&](const Event_<T, Tt> &e) { t += e.t; });
+    return t / n;
+  }
+
+  /*!
+  \brief Calculate the midpoint time between the oldest and the newest event (consumer).
+  \return Midpoint time.
+  */
+  [[nodiscard]] inline double midTime() const {
+    return 0.5 * (static_cast<double>(front().t) + static_cast<double>(back().t));
+  }
+
+private:
+  template <typename F>
+  inline std::size_t accumulate(F &&f) const {
+    const std::size_t head = head_.load(std::memory_order_relaxed);
+    const std::size_t tail = tail_.load(std::memory_order_acquire);
+    for(std::size_t i = head; i != tail; i++) {
+      f(slots_[i & mask_]);
+    }
+    return tail - head;
+  }
+
+  alignas(CACHE_LINE) std::atomic<std::size_t> head_{0};
+  std::size_t tailCache_{0};
+  alignas(CACHE_LINE) std::atomic<std::size_t> tail_{0};
+  std::size_t headCache_{0};
+  alignas(CACHE_LINE) std::vector<Event_<T, Tt>> slots_;
+  std::size_t mask_{0};
+};
+using SpscRingi = SpscRing_<int>;    /*!< Alias for SpscRing_ using int */
+using SpscRingl = SpscRing_<long>;   /*!< Alias for SpscRing_ using long */
+using SpscRingf = SpscRing_<float>;  /*!< Alias for SpscRing_ using float */
+using SpscRingd = SpscRing_<double>; /*!< Alias for SpscRing_ using double */
+using SpscRing = SpscRingi;          /*!< Alias for SpscRing_ using int */
+} // namespace ev
+
+#endif // OPENEV_CONTAINERS_SPSC_RING_HPP
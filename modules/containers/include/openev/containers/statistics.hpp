@@ -0,0 +1,147 @@
+/*!
+\file statistics.hpp
+\brief Running statistics for event containers.
+\author Raul Tapia
+*/
+#ifndef OPENEV_CONTAINERS_STATISTICS_HPP
+#define OPENEV_CONTAINERS_STATISTICS_HPP
+
+#include "openev/core/types.hpp"
+#include <cstddef>
+#include <opencv2/core/types.hpp>
+
+namespace ev {
+/*!
+\brief This class implements running sums of the attributes of a set of events, so that their means are computed in O(1).
+
+Events are added and removed one by one. Timestamps are accumulated relative to the first event added after the statistics have been emptied, which keeps the sums small for long captures.
+
+Containers use this class when statistics tracking is enabled (e.g., Vector_::track()).
+\note Sums of integral attributes are exact. Sums of floating-point attributes accumulate rounding errors as events are added and removed; they are rebased whenever the statistics become empty.
+*/
+template <typename T, typename Tt = double>
+class RunningStatistics_ {
+public:
+  RunningStatistics_() = default;
+
+  /*!
+  Constructor.
+  \param first Iterator to the first event
+  \param last Iterator past the last event
+  */
+  template <typename It>
+  RunningStatistics_(It first, const It last) {
+    assign(first, last);
+  }
+
+  /*!
+  \brief Add an event to the sums.
+  \param e Event
+  */
+  inline void add(const Event_<T, Tt> &e) {
+    if(!valid_) {
+      return;
+    }
+    if(n_ == 0) {
+      t0_ = static_cast<double>(e.t);
+    }
+    x_ += static_cast<double>(e.x);
+    y_ += static_cast<double>(e.y);
+    t_ += static_cast<double>(e.t) - t0_;
+    p_ += static_cast<double>(e.p);
+    n_++;
+  }
+
+  /*!
+  \brief Remove an event from the sums.
+  \param e Event, which must have been added before
+  */
+  inline void remove(const Event_<T, Tt> &e) {
+    if(!valid_ || n_ == 0) {
+      return;
+    }
+    if(--n_ == 0) {
+      clear();
+      return;
+    }
+    x_ -= static_cast<double>(e.x);
+    y_ -= static_cast<double>(e.y);
+    t_ -= static_cast<double>(e.t) - t0_;
+    p_ -= static_cast<double>(e.p);
+  }
+
+  /*!
+  \brief Remove all the events from the sums.
+  */
+  inline void clear() {
+    x_ = y_ = t_ = p_ = t0_ = 0;
+    n_ = 0;
+    valid_ = true;
+  }
+
+  /*!
+  \brief Recompute the sums from a range of events.
+  \param first Iterator to the first event
+  \param last Iterator past the last event
+  */
+  template <typename It>
+  inline void assign(It first, const It last) {
+    clear();
+    for(; first != last; ++first) {
+      add(*first);
+    }
+  }
+
+  /*!
+  \brief Mark the sums as outdated. Further calls to add() and remove() are ignored until clear() or assign() are called.
+  */
+  inline void invalidate() { valid_ = false; }
+
+  /*!
+  \brief Check if the sums are up to date.
+  \return True if valid
+  */
+  [[nodiscard]] inline bool valid() const { return valid_; }
+
+  /*!
+  \brief Number of events.
+  \return Number of events
+  */
+  [[nodiscard]] inline std::size_t size() const { return n_; }
+
+  /*!
+  \brief Mean of the events.
+  \return An Eventd object containing the mean values of x, y, t, and p attributes.
+  */
+  [[nodiscard]] inline Eventd mean() const {
+    return {x_ / n_, y_ / n_, meanTime(), p_ / n_ > 0.5};
+  }
+
+  /*!
+  \brief Mean x,y point of the events.
+  \return Mean point
+  */
+  [[nodiscard]] inline cv::Point2d meanPoint() const {
+    return {x_ / n_, y_ / n_};
+  }
+
+  /*!
+  \brief Mean time of the events.
+  \return Mean time
+  */
+  [[nodiscard]] inline double meanTime() const {
+    return t0_ + t_ / n_;
+  }
+
+private:
+  double x_{0};
+  double y_{0};
+  double t_{0};
+  double p_{0};
+  double t0_{0};
+  std::size_t n_{0};
+  bool valid_{true};
+};
+} // namespace ev
+
+#endif // OPENEV_CONTAINERS_STATISTICS_HPP
@@ -0,0 +1,222 @@
+/*!
+\file time-window.hpp
+\brief Sliding time window of events.
+\author Raul Tapia
+*/
+#ifndef OPENEV_CONTAINERS_TIME_WINDOW_HPP
+#define OPENEV_CONTAINERS_TIME_WINDOW_HPP
+
+#include "openev/containers/deque.hpp"
+#include "openev/core/types.hpp"
+#include <cstddef>
+#include <functional>
+#include <opencv2/core/types.hpp>
+#include <utility>
+
+namespace ev {
+/*!
+\brief This class implements a sliding time window of events.
+
+Events are appended in chronological order. Each insertion evicts, at once, all the events that fall out of the window, i.e., those older than the newest event minus the window duration. Running statistics (see RunningStatistics_) are kept, so mean(), meanPoint(), and meanTime() run in O(1).
+
+An eviction callback can be registered to keep other structures in sync with the window. For instance, a counter that only contains the events of the last 10 ms:
+\code{.cpp}
+ev::TimeWindow window(10e3);
+ev::Mat::Counter counter;
+counter.clear();
+window.onEvict([&counter](const ev::Event &e) { counter.remove(e); });
+while(reader.read(e)) {
+  counter.insert(e);
+  window.push_back(e);
+}
+\endcode
+\note Events are expected to be sorted by timestamp. Eviction stops at the first event that is still inside the window.
+*/
+template <typename T, typename Tt = double>
+class TimeWindow_ {
+public:
+  using Callback = std::function<void(const Event_<T, Tt> &)>;   /*!< Eviction callback type */
+  using const_iterator = typename Deque_<T, Tt>::const_iterator; /*!< Iterator type */
+
+  /*!
+  \brief Constructor.
+  \param window Duration of the window
+  */
+  explicit TimeWindow_(const double window) : window_{window} {
+    events_.track();
+  }
+
+  /*!
+  \brief Get the duration of the window.
+  \return Duration of the window
+  */
+  [[nodiscard]] inline double window() const { return window_; }
+
+  /*!
+  \brief Set the duration of the window. Events that fall out of the new window are evicted.
+  \param window Duration of the window
+  */
+  inline void setWindow(const double window) {
+    window_ = window;
+    if(!events_.empty()) {
+      evict(static_cast<double>(events_.back().t));
+    }
+  }
+
+  /*!
+  \brief Set the function called for every evicted event, before it is removed.
+  \param callback Eviction callback. Pass nullptr to disable it.
+  */
+  inline void onEvict(Callback callback) { callback_ = std::move(callback); }
+
+  /*!
+  \brief Append an event and evict the events that fall out of the window.
+  \param e Event
+  */
+  inline void push_back(const Event_<T, Tt> &e) {
+    events_.push_back(e);
+    evict(static_cast<double>(e.t));
+  }
+
+  /*!
+  \brief Construct an event in place, append it, and evict the events that fall out of the window.
+  \param args Arguments of the event constructor
+  */
+  template <typename... Args>
+  inline void emplace_back(Args &&...args) {
+    push_back(Event_<T, Tt>(std::forward<Args>(args)...));
+  }
+
+  /*!
+  \brief Append several events and evict the events that fall out of the window once, after the last insertion.
+  \param first Iterator to the first event
+  \param last Iterator past the last event
+  \note Events appended and evicted in the same call are also passed to the eviction callback.
+  */
+  template <typename It>
+  inline void append(It first, const It last) {
+    if(first == last) {
+      return;
+    }
+    for(; first != last; ++first) {
+      events_.push_back(*first);
+    }
+    evict(static_cast<double>(events_.back().t));
+  }
+
+  /*!
+  \brief Evict the events that are older than a given time minus the window duration.
+  \param t Current time
+  \return Number of evicted events
+  */
+  inline std::size_t evict(const double t) {
+    const double limit = t - window_;
+    std::size_t n = 0;
+    while(n < events_.size() && static_cast<double>(events_[n].t) < limit) {
+      if(callback_) {
+        callback_(events_[n]);
+      }
+      n++;
+    }
+    for(std::size_t i = 0; i < n; i++) {
+      events_.pop_front();
+    }
+    return n;
+  }
+
+  /*!
+  \brief Remove all the events without calling the eviction callback.
+  */
+  inline void clear() { events_.clear(); }
+
+  /*!
+  \brief Number of events in the window.
+  \return Number of events
+  */
+  [[nodiscard]] inline std::size_t size() const { return events_.size(); }
+
+  /*!
+  \brief Check if the window is empty.
+  \return True if empty
+  */
+  [[nodiscard]] inline bool empty() const { return events_.empty(); }
+
+  /*!
+  \brief Access the i-th oldest event.
+  \param i Index
+  \return Event
+  */
+  [[nodiscard]] inline const Event_<T, Tt> &operator[](const std::size_t i) const { return events_[i]; }
+
+  /*!
+  \brief Access the oldest event.
+  \return Oldest event
+  */
+  [[nodiscard]] inline const Event_<T, Tt> &front() const { return events_.front(); }
+
+  /*!
+  \brief Access the newest event.
+  \return Newest event
+  */
+  [[nodiscard]] inline const Event_<T, Tt> &back() const { return events_.back(); }
+
+  /*! \cond INTERNAL */
+  [[nodiscard]] inline const_iterator begin() const { return events_.begin(); }
+  [[nodiscard]] inline const_iterator end() const { return events_.end(); }
+  /*! \endcond */
+
+  /*!
+  \brief Get the events in the window.
+  \return Events, sorted from the oldest to the newest
+  */
+  [[nodiscard]] inline const Deque_<T, Tt> &events() const { return events_; }
+
+  /*!
+  \brief Time difference between the newest and the oldest event.
+  \return Time difference
+  */
+  [[nodiscard]] inline double duration() const { return events_.duration(); }
+
+  /*!
+  \brief Compute event rate as the ratio between the number of events and the time difference between the newest and the oldest event.
+  \return Event rate
+  */
+  [[nodiscard]] inline double rate() const { return events_.rate(); }
+
+  /*!
+  \brief Compute the mean of the events in O(1).
+  \return An Eventd object containing the mean values of x, y, t, and p attributes.
+  */
+  [[nodiscard]] inline Eventd mean() const { return events_.mean(); }
+
+  /*!
+  \brief Compute the mean x,y point of the events in O(1).
+  \return Mean point
+  */
+  [[nodiscard]] inline cv::Point2d meanPoint() const { return events_.meanPoint(); }
+
+  /*!
+  \brief Compute the mean time of the events in O(1).
+  \return Mean time
+  */
+  [[nodiscard]] inline double meanTime() const { return events_.meanTime(); }
+
+  /*!
+  \brief Calculate the midpoint time between the oldest and the newest event.
+  \return Midpoint time.
+  */
+  [[nodiscard]] inline double midTime() const { return events_.midTime(); }
+
+private:
+  Deque_<T, Tt> events_;
+  double window_;
+  Callback callback_;
+};
+using TimeWindowi = TimeWindow_<int>;    /*!< Alias for TimeWindow_ using int */
+using TimeWindowl = TimeWindow_<long>;   /*!< Alias for TimeWindow_ using long */
+using TimeWindowf = TimeWindow_<float>;  /*!< Alias for TimeWindow_ using float */
+using TimeWindowd = TimeWindow_<double>; /*!< Alias for TimeWindow_ using double */
+using TimeWindow = TimeWindowi;          /*!< Alias for TimeWindow_ using int */
+} // namespace ev
+
+#endif // OPENEV_CONTAINERS_TIME_WINDOW_HPP
@@ -6,28 +6,153 @@
 #ifndef OPENEV_CONTAINERS_VECTOR_HPP
 #define OPENEV_CONTAINERS_VECTOR_HPP
 
+#include "openev/containers/event-span.hpp"
+#include "openev/containers/statistics.hpp"
 #include "openev/core/types.hpp"
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
 #include <numeric>
 #include <opencv2/core/types.hpp>
+#include <optional>
+#include <utility>
 #include <vector>
 
 namespace ev {
 /*!
 \brief This class extends std::vector to implement event vectors. For more information, please refer <a href="https://en.cppreference.com/w/cpp/container/vector">here</a>.
 
-Event vectors inherit all the properties from standard C++ vectors. Events in the vector are stored contiguously.
+Event vectors inherit all the properties from standard C++ vectors. Events in the vector are stored contiguously. The allocator can be replaced, e.g., to take memory from an arena or a pool (see ev::pmr).
 */
-template <typename T>
-class Vector_ : public std::vector<Event_<T>> {
-  using std::vector<Event_<T>>::vector;
+template <typename T, typename Tt = double, typename Alloc = std::allocator<Event_<T, Tt>>>
+class Vector_ : public std::vector<Event_<T, Tt>, Alloc> {
+  using std::vector<Event_<T, Tt>, Alloc>::vector;
 
 public:
+  /*!
+  \brief Enable or disable statistics tracking.
+
+  When enabled, running sums of the events (see RunningStatistics_) are updated by push_back(), emplace_back(), pop_back(), and clear(), so that mean(), meanPoint(), and meanTime() run in O(1). Other modifications through member functions (e.g., insert(), erase(), resize(), or assign()) invalidate the sums, which are recomputed in O(n) on the next query and kept up to date again from then on. Writing events through iterators, operator[], or a reference to the base class is not detected: call track() again after it.
+  \param enable True to enable tracking
+  */
+  inline void track(const bool enable = true) {
+    if(enable) {
+      stats_.emplace(std::vector<Event_<T, Tt>, Alloc>::begin(), std::vector<Event_<T, Tt>, Alloc>::end());
+    } else {
+      stats_.reset();
+    }
+  }
+
+  /*!
+  \brief Check if statistics tracking is enabled.
+  \return True if enabled
+  */
+  [[nodiscard]] inline bool tracking() const { return stats_.has_value(); }
+
+  /*! \cond INTERNAL */
+  inline void push_back(const Event_<T, Tt> &e) {
+    if(stats_) {
+      stats_->add(e);
+    }
+    std::vector<Event_<T, Tt>, Alloc>::push_back(e);
+  }
+
+  template <typename... Args>
+  inline decltype(auto) emplace_back(Args &&...args) {
+    decltype(auto) e = std::vector<Event_<T, Tt>, Alloc>::emplace_back(std::forward<Args>(args)...);
+    if(stats_) {
+      stats_->add(e);
+    }
+    return e;
+  }
+
+  inline void pop_back() {
+    if(stats_) {
+      stats_->remove(std::vector<Event_<T, Tt>, Alloc>::back());
+    }
+    std::vector<Event_<T, Tt>, Alloc>::pop_back();
+  }
+
+  inline void clear() {
+    if(stats_) {
+      stats_->clear();
+    }
+    std::vector<Event_<T, Tt>, Alloc>::clear();
+  }
+
+  template <typename... Args>
+  inline decltype(auto) resize(Args &&...args) {
+    invalidate();
+    return std::vector<Event_<T, Tt>, Alloc>::resize(std::forward<Args>(args)...);
+  }
+
+  template <typename... Args>
+  inline decltype(auto) insert(Args &&...args) {
+    invalidate();
+    return std::vector<Event_<T, Tt>, Alloc>::insert(std::forward<Args>(args)...);
+  }
+
+  template <typename... Args>
+  inline decltype(auto) emplace(Args &&...args) {
+    invalidate();
+    return std::vector<Event_<T, Tt>, Alloc>::emplace(std::forward<Args>(args)...);
+  }
+
+  template <typename... Args>
+  inline decltype(auto) erase(Args &&...args) {
+    invalidate();
+    return std::vector<Event_<T, Tt>, Alloc>::erase(std::forward<Args>(args)...);
+  }
+
+  template <typename... Args>
+  inline decltype(auto) assign(Args &&...args) {
+    invalidate();
+    return std::vector<Event_<T, Tt>, Alloc>::assign(std::forward<Args>(args)...);
+  }
+
+  inline typename std::vector<Event_<T, Tt>, Alloc>::iterator insert(typename std::vector<Event_<T, Tt>, Alloc>::const_iterator pos, std::initializer_list<Event_<T, Tt>> list) {
+    invalidate();
+    return std::vector<Event_<T, Tt>, Alloc>::insert(pos, list);
+  }
+
+  inline void assign(std::initializer_list<Event_<T, Tt>> list) {
+    invalidate();
+    std::vector<Event_<T, Tt>, Alloc>::assign(list);
+  }
+
+  inline void swap(Vector_ &other) {
+    std::vector<Event_<T, Tt>, Alloc>::swap(other);
+    std::swap(stats_, other.stats_);
+  }
+  /*! \endcond */
+
+  /*!
+  \brief Obtain a view over the events with timestamps in [t0, t1) without copying them.
+  \param t0 Initial time (included)
+  \param t1 Final time (excluded)
+  \return Event span
+  \note Events must be sorted by timestamp. Complexity is logarithmic in the number of events.
+  */
+  [[nodiscard]] inline EventSpan_<T, Tt> slice_t(const double t0, const double t1) const {
+    return EventSpan_<T, Tt>(*this).slice_t(t0, t1);
+  }
+
+  /*!
+  \brief Obtain a view over a range of events without copying them.
+  \param i Index of the first event
+  \param n Number of events
+  \return Event span. It is truncated at the end of the container.
+  */
+  [[nodiscard]] inline EventSpan_<T, Tt> slice_n(const std::size_t i, const std::size_t n) const {
+    return EventSpan_<T, Tt>(*this).slice_n(i, n);
+  }
+
   /*!
   \brief Time difference between the last and the first event.
   \return Time difference
   */
   [[nodiscard]] inline double duration() const {
-    return std::vector<ev::Event_<T>>::back().t - std::vector<ev::Event_<T>>::front().t;
+    return std::vector<Event_<T, Tt>, Alloc>::back().t - std::vector<Event_<T, Tt>, Alloc>::front().t;
   }
 
   /*!
@@ -35,7 +160,7 @@ public:
   \return Event rate
   */
   [[nodiscard]] inline double rate() const {
-    return std::vector<ev::Event_<T>>::size() / duration();
+    return std::vector<Event_<T, Tt>, Alloc>::size() / duration();
   }
 
   /*!
@@ -43,10 +168,13 @@ public:
   \return An Eventd object containing the mean values of x, y, t, and p attributes.
   */
   [[nodiscard]] inline Eventd mean() const {
-    const double x = std::accumulate(std::vector<ev::Event_<T>>::begin(), std::vector<ev::Event_<T>>::end(), 0.0, [](double sum, const Event_<T> &e) { return sum + e.x; }) / std::vector<ev::Event_<T>>::size();
-    const double y = std::accumulate(std::vector<ev::Event_<T>>::begin(), std::vector<ev::Event_<T>>::end(), 0.0, [](double sum, const Event_<T> &e) { return sum + e.y; }) / std::vector<ev::Event_<T>>::size();
-    const double t = std::accumulate(std::vector<ev::Event_<T>>::begin(), std::vector<ev::Event_<T>>::end(), 0.0, [](double sum, const Event_<T> &e) { return sum + e.t; }) / std::vector<ev::Event_<T>>::size();
-    const double p = std::accumulate(std::vector<ev::Event_<T>>::begin(), std::vector<ev::Event_<T>>::end(), 0.0, [](double sum, const Event_<T> &e) { return sum + e.p; }) / std::vector<ev::Event_<T>>::size();
+    if(stats_) {
+      return statistics().mean();
+    }
+    const double x = std::accumulate(std::vector<Event_<T, Tt>, Alloc>::begin(), std::vector<Event_<T, Tt>, Alloc>::end(), 0.0, [](double sum, const Event_<T, Tt> &e) { return sum + e.x; }) / std::vector<Event_<T, Tt>, Alloc>::size();
+    const double y = std::accumulate(std::vector<Event_<T, Tt>, Alloc>::begin(), std::vector<Event_<T, Tt>, Alloc>::end(), 0.0, [](double sum, const Event_<T, Tt> &e) { return sum + e.y; }) / std::vector<Event_<T, Tt>, Alloc>::size();
+    const double t = std::accumulate(std::vector<Event_<T, Tt>, Alloc>::begin(), std::vector<Event_<T, Tt>, Alloc>::end(), 0.0, [](double sum, const Event_<T, Tt> &e) { return sum + e.t; }) / std::vector<Event_<T, Tt>, Alloc>::size();
+    const double p = std::accumulate(std::vector<Event_<T, Tt>, Alloc>::begin(), std::vector<Event_<T, Tt>, Alloc>::end(), 0.0, [](double sum, const Event_<T, Tt> &e) { return sum + e.p; }) / std::vector<Event_<T, Tt>, Alloc>::size();
     return {x, y, t, p > 0.5};
   }
 
@@ -55,8 +183,11 @@ public:
   \return Mean point
   */
   [[nodiscard]] inline cv::Point2d meanPoint() const {
-    const double x = std::accumulate(std::vector<ev::Event_<T>>::begin(), std::vector<ev::Event_<T>>::end(), 0.0, [](double sum, const Event_<T> &e) { return sum + e.x; }) / std::vector<ev::Event_<T>>::size();
-    const double y = std::accumulate(std::vector<ev::Event_<T>>::begin(), std::vector<ev::Event_<T>>::end(), 0.0, [](double sum, const Event_<T> &e) { return sum + e.y; }) / std::vector<ev::Event_<T>>::size();
+    if(stats_) {
+      return statistics().meanPoint();
+    }
+    const double x = std::accumulate(std::vector<Event_<T, Tt>, Alloc>::begin(), std::vector<Event_<T, Tt>, Alloc>::end(), 0.0, [](double sum, const Event_<T, Tt> &e) { return sum + e.x; }) / std::vector<Event_<T, Tt>, Alloc>::size();
+    const double y = std::accumulate(std::vector<Event_<T, Tt>, Alloc>::begin(), std::vector<Event_<T, Tt>, Alloc>::end(), 0.0, [](double sum, const Event_<T, Tt> &e) { return sum + e.y; }) / std::vector<Event_<T, Tt>, Alloc>::size();
     return {x, y};
   }
 
@@ -65,7 +196,10 @@ public:
   \return Mean time
   */
   [[nodiscard]] inline double meanTime() const {
-    return std::accumulate(std::vector<ev::Event_<T>>::begin(), std::vector<ev::Event_<T>>::end(), 0.0, [](double sum, const Event_<T> &e) { return sum + e.t; }) / std::vector<ev::Event_<T>>::size();
+    if(stats_) {
+      return statistics().meanTime();
+    }
+    return std::accumulate(std::vector<Event_<T, Tt>, Alloc>::begin(), std::vector<Event_<T, Tt>, Alloc>::end(), 0.0, [](double sum, const Event_<T, Tt> &e) { return sum + e.t; }) / std::vector<Event_<T, Tt>, Alloc>::size();
   }
 
   /*!
@@ -73,8 +207,24 @@ public:
   \return Midpoint time.
   */
   [[nodiscard]] inline double midTime() const {
-    return 0.5 * (std::vector<ev::Event_<T>>::front().t + std::vector<ev::Event_<T>>::back().t);
+    return 0.5 * (static_cast<double>(std::vector<Event_<T, Tt>, Alloc>::front().t) + static_cast<double>(std::vector<Event_<T, Tt>, Alloc>::back().t));
   }
+
+private:
+  inline void invalidate() {
+    if(stats_) {
+      stats_->invalidate();
+    }
+  }
+
+  [[nodiscard]] inline const RunningStatistics_<T, Tt> &statistics() const {
+    if(!stats_->valid()) {
+      stats_->assign(std::vector<Event_<T, Tt>, Alloc>::begin(), std::vector<Event_<T, Tt>, Alloc>::end());
+    }
+    return *stats_;
+  }
+
+  mutable std::optional<RunningStatistics_<T, Tt>> stats_;
 };
 using Vectori = Vector_<int>;    /*!< Alias for Vector_ using int */
 using Vectorl = Vector_<long>;   /*!< Alias for Vector_ using long */
@@ -0,0 +1 @@
+#include "openev/containers/augmented-batch.hpp"
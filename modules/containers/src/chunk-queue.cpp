@@ -0,0 +1 @@
+#include "openev/containers/chunk-queue.hpp"
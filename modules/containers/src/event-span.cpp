@@ -0,0 +1 @@
+#include "openev/containers/event-span.hpp"
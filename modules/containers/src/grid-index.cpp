@@ -0,0 +1 @@
+#include "openev/containers/grid-index.hpp"
@@ -0,0 +1 @@
+#include "openev/containers/span.hpp"
@@ -0,0 +1 @@
+#include "openev/containers/spsc-ring.hpp"
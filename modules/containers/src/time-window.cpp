@@ -0,0 +1 @@
+#include "openev/containers/time-window.hpp"
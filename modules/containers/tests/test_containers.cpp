@@ -1,10 +1,49 @@
 #include "openev/containers/array.hpp"
+#include "openev/containers/augmented-batch.hpp"
+#include "openev/containers/batch.hpp"
+#include "openev/containers/chunk-queue.hpp"
 #include "openev/containers/circular.hpp"
+#include "openev/containers/codec.hpp"
 #include "openev/containers/deque.hpp"
+#include "openev/containers/describe.hpp"
+#include "openev/containers/distance.hpp"
+#include "openev/containers/event-span.hpp"
+#include "openev/containers/grid-index.hpp"
+#include "openev/containers/packed.hpp"
+#include "openev/containers/pmr.hpp"
 #include "openev/containers/queue.hpp"
+#include "openev/containers/region.hpp"
+#include "openev/containers/spsc-ring.hpp"
+#include "openev/containers/time-window.hpp"
 #include "openev/containers/vector.hpp"
+#include "openev/core/matrices.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
 #include <gtest/gtest.h>
+#include <memory_resource>
 #include <opencv2/opencv.hpp>
+#include <random>
+#include <thread>
+#include <vector>
+
+class CountingResource : public std::pmr::memory_resource {
+public:
+  std::size_t allocations{0};
+
+private:
+  void *do_allocate(const std::size_t bytes, const std::size_t alignment) override {
+    allocations++;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+  void do_deallocate(void *p, const std::size_t bytes, const std::size_t alignment) override {
+    std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+  }
+  [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override {
+    return this == &other;
+  }
+};
 
 template <typename Container>
 class ContainerTestFixture : public ::testing::Test {
@@ -79,3 +118,928 @@ TEST(CircularBuffer, EmplaceBack) {
   EXPECT_EQ(buffer[0], ev::Event(10, 20, 1.0, true));
   EXPECT_EQ(buffer[1], ev::Event(30, 40, 2.0, false));
 }
+
+template <typename Container>
+void expectTrackedStatistics(Container &container) {
+  ASSERT_TRUE(container.tracking());
+  const ev::Eventd tracked = container.mean();
+  const cv::Point2d trackedPoint = container.meanPoint();
+  const double trackedTime = container.meanTime();
+  container.track(false);
+  EXPECT_NEAR(tracked.x, container.mean().x, 1e-9);
+  EXPECT_NEAR(tracked.y, container.mean().y, 1e-9);
+  EXPECT_NEAR(tracked.t, container.mean().t, 1e-6);
+  EXPECT_EQ(tracked.p, container.mean().p);
+  EXPECT_NEAR(trackedPoint.x, container.meanPoint().x, 1e-9);
+  EXPECT_NEAR(trackedTime, container.meanTime(), 1e-6);
+  container.track();
+}
+
+TEST(Tracking, Vector) {
+  ev::Vector vector;
+  vector.emplace_back(1, 2, 1000.0, true);
+  vector.track();
+  for(int i = 0; i < 50; i++) {
+    vector.emplace_back(i, 3 * i, 1000.5 + i, i % 3 == 0);
+  }
+  expectTrackedStatistics(vector);
+  vector.pop_back();
+  vector.push_back(ev::Event(7, 9, 2000.0, false));
+  expectTrackedStatistics(vector);
+  vector.clear();
+  vector.emplace_back(4, 5, 3000.0, true);
+  expectTrackedStatistics(vector);
+}
+
+TEST(Tracking, Deque) {
+  ev::Deque deque;
+  deque.track();
+  for(int i = 0; i < 50; i++) {
+    deque.emplace_back(i, 2 * i, 1e6 + i, i % 2 == 0);
+    deque.emplace_front(-i, i, 1e6 - i, i % 5 == 0);
+  }
+  for(int i = 0; i < 20; i++) {
+    deque.pop_front();
+  }
+  deque.pop_back();
+  expectTrackedStatistics(deque);
+}
+
+TEST(Tracking, CircularBufferEviction) {
+  ev::CircularBuffer buffer(16);
+  buffer.track();
+  for(int i = 0; i < 100; i++) {
+    buffer.emplace_back(i % 13, i % 7, 0.001 * i, i % 4 == 0);
+  }
+  ASSERT_EQ(buffer.size(), 16U);
+  expectTrackedStatistics(buffer);
+  buffer.push_front(ev::Event(1, 1, 0.0, true));
+  buffer.pop_back();
+  expectTrackedStatistics(buffer);
+}
+
+TEST(Tracking, ReaderStyleFill) {
+  ev::Vector vector;
+  vector.track();
+  vector.emplace_back(1, 2, 1.0, true);
+  const std::size_t current = vector.size();
+  vector.resize(current + 20);
+  for(int i = 0; i < 20; i++) {
+    vector[current + i] = ev::Event(i, 2 * i, 2.0 + i, i % 2 == 0);
+  }
+  vector.resize(current + 15);
+  expectTrackedStatistics(vector);
+  vector.emplace_back(100, 100, 40.0, true);
+  expectTrackedStatistics(vector);
+}
+
+TEST(Tracking, UntrackedModifications) {
+  ev::Vector vector;
+  vector.track();
+  for(int i = 0; i < 10; i++) {
+    vector.emplace_back(i, i, static_cast<double>(i), true);
+  }
+  vector.insert(vector.begin() + 2, ev::Event(50, 60, 0.5, false));
+  vector.erase(vector.begin() + 5);
+  expectTrackedStatistics(vector);
+  vector.assign({ev::Event(1, 1, 1.0, true), ev::Event(3, 5, 2.0, false)});
+  expectTrackedStatistics(vector);
+
+  ev::Deque deque;
+  deque.track();
+  deque.assign(5, ev::Event(2, 4, 1.0, true));
+  deque.insert(deque.begin(), {ev::Event(9, 9, 0.5, false)});
+  deque.pop_back();
+  expectTrackedStatistics(deque);
+
+  ev::CircularBuffer buffer(8);
+  buffer.track();
+  for(int i = 0; i < 8; i++) {
+    buffer.emplace_back(i, i, static_cast<double>(i), true);
+  }
+  buffer.erase_begin(3);
+  buffer.rinsert(buffer.begin(), ev::Event(7, 1, 0.5, false));
+  buffer.set_capacity(4);
+  expectTrackedStatistics(buffer);
+
+  ev::RunningStatistics_<int> statistics;
+  statistics.remove(ev::Event(1, 1, 1.0, true));
+  EXPECT_EQ(statistics.size(), 0U);
+}
+
+TEST(PackedVector, PackUnpack) {
+  ev::Vector vector;
+  vector.emplace_back(34, 10, 1214300, true);
+  vector.emplace_back(45, 14, 3234200, false);
+  vector.emplace_back(87, 23, 5343200, true);
+  const ev::PackedVector packed(vector);
+  ASSERT_EQ(packed.size(), 3U);
+  EXPECT_EQ(packed[1], ev::PackedEvent(45, 14, 3234200, false));
+  EXPECT_EQ(packed.unpack(), vector);
+}
+
+TEST(PackedVector, Statistics) {
+  ev::PackedVector packed;
+  packed.emplace_back(34, 10, 1214300, true);
+  packed.emplace_back(45, 14, 3234200, false);
+  packed.emplace_back(87, 23, 5343200, true);
+  EXPECT_DOUBLE_EQ(packed.duration(), 5343200.0 - 1214300.0);
+  EXPECT_DOUBLE_EQ(packed.rate(), 3.0 / (5343200.0 - 1214300.0));
+  EXPECT_DOUBLE_EQ(packed.mean().x, (34 + 45 + 87) / 3.0);
+  EXPECT_DOUBLE_EQ(packed.mean().y, (10 + 14 + 23) / 3.0);
+  EXPECT_DOUBLE_EQ(packed.meanTime(), (1214300.0 + 3234200.0 + 5343200.0) / 3.0);
+  EXPECT_DOUBLE_EQ(packed.midTime(), (1214300.0 + 5343200.0) / 2.0);
+  EXPECT_TRUE(packed.mean().p);
+}
+
+TEST(PackedVector, InsertIntoContainers) {
+  const ev::PackedEvent packed(10, 20, 1000, false);
+  ev::Vector vector;
+  vector.push_back(packed);
+  ev::CircularBuffer buffer(2);
+  buffer.push_back(packed);
+  buffer.emplace_back(packed);
+  EXPECT_EQ(vector[0], ev::Event(10, 20, 1000, false));
+  EXPECT_EQ(buffer[1], ev::Event(10, 20, 1000, false));
+}
+
+TEST(EventBatch, Conversion) {
+  ev::Vector vector;
+  vector.emplace_back(34, 10, 1.2143, true);
+  vector.emplace_back(45, 14, 3.2342, false);
+  vector.emplace_back(87, 23, 5.3432, true);
+  const ev::EventBatch batch(vector);
+  ASSERT_EQ(batch.size(), 3U);
+  EXPECT_EQ(batch[1], ev::Event(45, 14, 3.2342, false));
+  EXPECT_EQ(batch.toVector(), vector);
+  EXPECT_EQ(batch.x()[2], 87);
+  EXPECT_EQ(batch.p()[1], 0);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(batch.t().data()) % ev::simd::ALIGNMENT, 0U);
+}
+
+TEST(EventBatch, Statistics) {
+  ev::Vector vector;
+  for(int i = 0; i < 21; i++) {
+    vector.emplace_back(i, 2 * i, 1000.0 + i, i % 3 == 0);
+  }
+  ev::EventBatch batch;
+  batch.assign(vector);
+  EXPECT_DOUBLE_EQ(batch.duration(), vector.duration());
+  EXPECT_DOUBLE_EQ(batch.rate(), vector.rate());
+  EXPECT_DOUBLE_EQ(batch.mean().x, vector.mean().x);
+  EXPECT_DOUBLE_EQ(batch.mean().y, vector.mean().y);
+  EXPECT_EQ(batch.mean().p, vector.mean().p);
+  EXPECT_DOUBLE_EQ(batch.meanPoint().x, vector.meanPoint().x);
+  EXPECT_DOUBLE_EQ(batch.meanTime(), vector.meanTime());
+  EXPECT_DOUBLE_EQ(batch.midTime(), vector.midTime());
+}
+
+TEST(AugmentedEventBatch, Conversion) {
+  std::vector<ev::AugmentedEventd> vector;
+  for(int i = 0; i < 70; i++) {
+    vector.emplace_back(i + 0.5, 2.0 * i, 1000.0 + i, i % 2 == 0);
+    vector.back().weight = 0.25 * i;
+    vector.back().depth = 1.5;
+    vector.back().stereo = i % 3 == 0 ? ev::Stereo::RIGHT : ev::Stereo::LEFT;
+  }
+  ev::AugmentedEventBatchd batch(vector);
+  ASSERT_EQ(batch.size(), 70U);
+  for(std::size_t i = 0; i < batch.size(); i++) {
+    EXPECT_EQ(batch[i], vector[i]);
+    EXPECT_DOUBLE_EQ(batch[i].weight, vector[i].weight);
+    EXPECT_DOUBLE_EQ(batch[i].depth, vector[i].depth);
+    EXPECT_EQ(batch.stereo(i), vector[i].stereo);
+  }
+  EXPECT_DOUBLE_EQ(batch.totalWeight(), 0.25 * 69 * 70 / 2);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(batch.weight().data()) % ev::simd::ALIGNMENT, 0U);
+
+  batch.resize(65);
+  batch.resize(70);
+  EXPECT_EQ(batch.stereo(66), ev::Stereo::LEFT);
+  EXPECT_FLOAT_EQ(batch[66].weight, 1.0F);
+  batch.emplace_back(1.0, 2.0, 3.0, true, 0.5F, 2.0F, ev::Stereo::RIGHT);
+  EXPECT_EQ(batch.back().stereo, ev::Stereo::RIGHT);
+  EXPECT_FLOAT_EQ(batch.back().weight, 0.5F);
+}
+
+TEST(AugmentedEventBatch, Accumulate) {
+  ev::Vector vector;
+  vector.emplace_back(1, 1, 0.0, true);
+  vector.emplace_back(1, 1, 1.0, true);
+  vector.emplace_back(2, 0, 2.0, false);
+  vector.emplace_back(-1, 0, 3.0, false);
+  ev::AugmentedEventBatch batch(ev::EventBatch{vector});
+  batch.weight()[1] = 2.0F;
+  cv::Mat_<float> image(3, 3, 0.0F);
+  batch.accumulate(image);
+  EXPECT_FLOAT_EQ(image(1, 1), 3.0F);
+  EXPECT_FLOAT_EQ(image(0, 2), 1.0F);
+  EXPECT_FLOAT_EQ(image(0, 0), 0.0F);
+  EXPECT_DOUBLE_EQ(batch.weightedMeanPoint().x, 4.0 / 5.0);
+
+  batch.weight()[0] = batch.weight()[1] = batch.weight()[2] = batch.weight()[3] = 0.0F;
+  EXPECT_DOUBLE_EQ(batch.weightedMeanPoint().x, 3.0 / 4.0);
+  EXPECT_DOUBLE_EQ(batch.weightedMeanPoint().y, 2.0 / 4.0);
+  EXPECT_DOUBLE_EQ(ev::AugmentedEventBatch().weightedMeanPoint().x, 0.0);
+}
+
+TEST(Timebase, IntegerTimestamps) {
+  ev::Vector_<int, uint32_t> vector;
+  vector.emplace_back(34, 10, 4294967000U, true);
+  vector.emplace_back(45, 14, 4294967200U, false);
+  vector.emplace_back(87, 23, 4294967290U, true);
+  EXPECT_DOUBLE_EQ(vector.duration(), 290.0);
+  EXPECT_DOUBLE_EQ(vector.midTime(), 4294967145.0);
+  EXPECT_DOUBLE_EQ(vector.meanTime(), (4294967000.0 + 4294967200.0 + 4294967290.0) / 3.0);
+
+  const ev::EventBatch_<int, uint32_t> batch(vector);
+  EXPECT_DOUBLE_EQ(batch.duration(), 290.0);
+  EXPECT_DOUBLE_EQ(batch.meanTime(), vector.meanTime());
+  EXPECT_EQ(batch.toVector(), vector);
+
+  const ev::PackedVector packed(vector);
+  EXPECT_EQ((packed.unpack<int, uint32_t>()), vector);
+}
+
+
+TEST(Distance, MatchesEventDistance) {
+  ev::Vectord vector;
+  for(int i = 0; i < 37; i++) {
+    vector.emplace_back(0.5 * i, 17.0 - i, 0.1 * i * i, i % 2 == 0);
+  }
+  const ev::EventBatchd batch(vector);
+  const ev::Eventd query(4.2, 3.1, 7.5, true);
+  for(const uint8_t norm : {ev::DISTANCE_NORM_INF, ev::DISTANCE_NORM_L1, ev::DISTANCE_NORM_L2, ev::DISTANCE_NORM_L2SQR}) {
+    for(const uint8_t flag : {ev::DISTANCE_FLAG_SPATIAL, ev::DISTANCE_FLAG_TEMPORAL, ev::DISTANCE_FLAG_SPATIOTEMPORAL}) {
+      std::vector<double> d1;
+      std::vector<double> d2;
+      ev::distance(query, vector, d1, norm | flag);
+      ev::distance(query, batch, d2, norm | flag);
+      ASSERT_EQ(d1.size(), vector.size());
+      ASSERT_EQ(d2.size(), vector.size());
+      for(std::size_t i = 0; i < vector.size(); i++) {
+        EXPECT_NEAR(d1[i], query.distance(vector[i], norm | flag), 1e-9);
+        EXPECT_NEAR(d2[i], query.distance(vector[i], norm | flag), 1e-9);
+      }
+    }
+  }
+}
+
+TEST(Distance, QueryBlock) {
+  ev::Vector vector;
+  vector.emplace_back(0, 0, 0.0, true);
+  vector.emplace_back(3, 4, 1.0, true);
+  vector.emplace_back(6, 8, 2.0, false);
+  cv::Mat_<double> d;
+  ev::distance(vector, ev::EventBatch(vector), d);
+  ASSERT_EQ(d.rows, 3);
+  ASSERT_EQ(d.cols, 3);
+  EXPECT_DOUBLE_EQ(d(0, 1), 5.0);
+  EXPECT_DOUBLE_EQ(d(2, 0), 10.0);
+  EXPECT_DOUBLE_EQ(d(1, 1), 0.0);
+}
+
+TEST(Distance, MixedTypes) {
+  ev::Vector vector;
+  vector.emplace_back(0, 0, 0.0, true);
+  vector.emplace_back(3, 4, 1.0, true);
+  vector.emplace_back(6, 8, 2.0, false);
+  const ev::EventBatch batch(vector);
+  ev::AugmentedEventBatch augmented(batch);
+  const ev::Eventf query(0.5F, 0.0F, 1.0, true);
+  std::vector<double> d1;
+  std::vector<double> d2;
+  std::vector<double> d3;
+  ev::distance(query, vector, d1);
+  ev::distance(query, batch, d2);
+  ev::distance(query, augmented, d3, ev::DISTANCE_NORM_L1 | ev::DISTANCE_FLAG_SPATIOTEMPORAL);
+  ASSERT_EQ(d2.size(), 3U);
+  ASSERT_EQ(d3.size(), 3U);
+  EXPECT_DOUBLE_EQ(d1[0], 0.5);
+  EXPECT_DOUBLE_EQ(d2[0], 0.5);
+  EXPECT_DOUBLE_EQ(d2[1], std::sqrt(2.5 * 2.5 + 16.0));
+  EXPECT_DOUBLE_EQ(d3[2], 5.5 + 8.0 + 1.0);
+  EXPECT_EQ(ev::knn(query, batch, 1), (std::vector<std::size_t>{0}));
+}
+
+TEST(Distance, NearestNeighbours) {
+  ev::Vector vector;
+  vector.emplace_back(10, 10, 0.0, true);
+  vector.emplace_back(1, 1, 5.0, true);
+  vector.emplace_back(5, 5, 1.0, false);
+  vector.emplace_back(0, 2, 9.0, true);
+  vector.emplace_back(2, 0, 3.0, false);
+  const ev::Event query(0, 0, 4.0, true);
+  EXPECT_EQ(ev::knn(query, vector, 3), (std::vector<std::size_t>{1, 3, 4}));
+  EXPECT_EQ(ev::knn(query, ev::EventBatch(vector), 2, ev::DISTANCE_FLAG_TEMPORAL), (std::vector<std::size_t>{1, 4}));
+  EXPECT_EQ(ev::knn(query, vector, 10).size(), vector.size());
+}
+
+TEST(Region, FilterRect3) {
+  ev::Vector vector;
+  for(int i = 0; i < 100; i++) {
+    vector.emplace_back(i % 10, i / 10, static_cast<double>(i), i % 2 == 0);
+  }
+  const ev::Rect3 rect(2, 2, 10, 5, 5, 60);
+  ev::Vector expected;
+  std::copy_if(vector.begin(), vector.end(), std::back_inserter(expected), [&rect](const ev::Event &e) { return rect.contains(e); });
+  EXPECT_EQ(ev::filter(rect, vector), expected);
+  EXPECT_EQ(ev::filter(rect, ev::EventBatch(vector)).toVector(), expected);
+}
+
+TEST(Region, UnionAndIntersection) {
+  ev::Vector vector;
+  for(int i = 0; i < 100; i++) {
+    vector.emplace_back(i % 10, i / 10, static_cast<double>(i), true);
+  }
+  const ev::Circ circ(cv::Point(2, 2), 2);
+  const ev::Rect3 rect(5, 5, 0, 5, 5, 100);
+  const auto region = ev::intersect(ev::unite(circ, rect), ev::Rect3(0, 0, 0, 10, 10, 80));
+  ev::Vector expected;
+  std::copy_if(vector.begin(), vector.end(), std::back_inserter(expected), [&region](const ev::Event &e) { return region.contains(e); });
+  EXPECT_EQ(ev::filter(region, vector), expected);
+
+  std::vector<uint64_t> bits;
+  ev::mask(region, vector, bits);
+  ASSERT_EQ(bits.size(), 2U);
+  for(std::size_t i = 0; i < vector.size(); i++) {
+    EXPECT_EQ(static_cast<bool>((bits[i / 64] >> (i % 64)) & 1U), region.contains(vector[i]));
+  }
+}
+
+TEST(Region, Partition) {
+  ev::Array<6> array;
+  for(int i = 0; i < 6; i++) {
+    array[i] = ev::Event(i, i, static_cast<double>(i), true);
+  }
+  ev::Vector inside;
+  ev::Vector outside;
+  ev::partition(ev::Circ(cv::Point(0, 0), 3), array, inside, outside);
+  ASSERT_EQ(inside.size(), 3U);
+  ASSERT_EQ(outside.size(), 3U);
+  EXPECT_EQ(inside[2], array[2]);
+  EXPECT_EQ(outside[0], array[3]);
+}
+
+TEST(EventGridIndex, QueriesMatchLinearScan) {
+  std::mt19937 gen(0);
+  std::uniform_int_distribution<> dis_x(0, 63);
+  std::uniform_int_distribution<> dis_y(0, 47);
+  ev::Vector vector;
+  for(int i = 0; i < 2000; i++) {
+    vector.emplace_back(dis_x(gen), dis_y(gen), static_cast<double>(i), i % 2 == 0);
+  }
+  ev::EventGridIndex index(cv::Size(64, 48), 8);
+  EXPECT_EQ(index.insert(vector), vector.size());
+  EXPECT_EQ(index.size(), vector.size());
+
+  const auto sorted = [](ev::Vector v) { std::sort(v.begin(), v.end(), [](const ev::Event &a, const ev::Event &b) { return a.t < b.t; }); return v; };
+
+  const ev::Rect3 rect(10, 5, 500, 20, 17, 300);
+  ev::Vector expected;
+  std::copy_if(vector.begin(), vector.end(), std::back_inserter(expected), [&rect](const ev::Event &e) { return rect.contains(e); });
+  ev::Vector found;
+  EXPECT_EQ(index.query(rect, found), expected.size());
+  EXPECT_EQ(sorted(found), expected);
+
+  const ev::Event &query = vector[1000];
+  expected.clear();
+  std::copy_if(vector.begin(), vector.end(), std::back_inserter(expected), [&query](const ev::Event &e) { return query.distance(e) <= 5 && std::abs(e.t - query.t) <= 200; });
+  found.clear();
+  EXPECT_EQ(index.neighbours(query, 5, 200.0, found), expected.size());
+  EXPECT_EQ(sorted(found), expected);
+}
+
+TEST(EventGridIndex, ExpiryAndOutOfOrderInsertion) {
+  ev::EventGridIndex index(cv::Size(10, 10), 4);
+  index.insert(ev::Event(1, 1, 3.0, true));
+  index.insert(ev::Event(2, 2, 1.0, true));
+  index.insert(ev::Event(1, 2, 2.0, true));
+  EXPECT_FALSE(index.insert(ev::Event(10, 1, 4.0, true)));
+  EXPECT_EQ(index.size(), 3U);
+  EXPECT_EQ(index.grid(), cv::Size(3, 3));
+  EXPECT_EQ(index.expire(2.5), 2U);
+  ev::Vector found;
+  index.query(ev::Rect3(0, 0, 0, 10, 10, 10), found);
+  ASSERT_EQ(found.size(), 1U);
+  EXPECT_EQ(found[0], ev::Event(1, 1, 3.0, true));
+  index.clear();
+  EXPECT_TRUE(index.empty());
+}
+
+TEST(Codec, EventBatchRoundTrip) {
+  ev::Vector vector;
+  for(int i = 0; i < 37; i++) {
+    vector.emplace_back(i, 2 * i, static_cast<double>(100 * i), i % 2 == 0);
+  }
+  const ev::EventBatch batch(vector);
+  std::vector<uint64_t> data;
+  ev::raw::encode(batch, data);
+  std::vector<uint64_t> expected;
+  ev::raw::encode(vector, expected);
+  EXPECT_EQ(data, expected);
+
+  ev::raw::Decoder decoder;
+  ev::EventBatch decoded;
+  ev::raw::decode(decoder, data, decoded);
+  EXPECT_EQ(decoded.toVector(), vector);
+}
+
+TEST(Codec, TrackedVector) {
+  ev::Vector vector;
+  for(int i = 0; i < 37; i++) {
+    vector.emplace_back(i, 3 * i, static_cast<double>(10 * i), i % 3 == 0);
+  }
+  std::vector<uint64_t> data;
+  ev::raw::encode(vector, data);
+
+  ev::raw::Decoder decoder;
+  ev::Vector tracked;
+  tracked.track();
+  tracked.emplace_back(100, 100, 0.0, true);
+  decoder.decode(data, tracked);
+  ASSERT_EQ(tracked.size(), vector.size() + 1);
+  ev::Vector untracked(tracked.begin(), tracked.end());
+  EXPECT_DOUBLE_EQ(tracked.mean().x, untracked.mean().x);
+  EXPECT_DOUBLE_EQ(tracked.mean().y, untracked.mean().y);
+  EXPECT_DOUBLE_EQ(tracked.meanTime(), untracked.meanTime());
+
+  ev::pmr::Arena arena;
+  ev::pmr::Vector pooled(&arena);
+  decoder.reset();
+  decoder.decode(data, pooled);
+  EXPECT_TRUE(std::equal(pooled.begin(), pooled.end(), vector.begin(), vector.end()));
+  std::vector<uint64_t> encoded;
+  ev::raw::encode(pooled, encoded);
+  EXPECT_EQ(encoded, data);
+}
+
+TEST(Region, MaskROI) {
+  cv::Mat_<uchar> mask(48, 64, static_cast<uchar>(0));
+  for(int y = 0; y < 48; y++) {
+    for(int x = 0; x < 64; x++) {
+      mask(y, x) = static_cast<uchar>((x * 7 + y * 3) % 5 == 0);
+    }
+  }
+  const ev::MaskROI roi(mask);
+  ev::Vector vector;
+  for(int i = 0; i < 1000; i++) {
+    vector.emplace_back((i * 13) % 70 - 3, (i * 29) % 50 - 1, static_cast<double>(i), i % 2 == 0);
+  }
+  ev::Vector expected;
+  std::copy_if(vector.begin(), vector.end(), std::back_inserter(expected), [&roi](const ev::Event &e) { return roi.contains(e); });
+  EXPECT_FALSE(expected.empty());
+  EXPECT_EQ(ev::filter(roi, vector), expected);
+  EXPECT_EQ(ev::filter(roi, ev::EventBatch(vector)).toVector(), expected);
+  const auto region = ev::unite(roi, ev::Rect(10, 10, 20, 20));
+  expected.clear();
+  std::copy_if(vector.begin(), vector.end(), std::back_inserter(expected), [&region](const ev::Event &e) { return region.contains(e); });
+  EXPECT_EQ(ev::filter(region, vector), expected);
+}
+
+TEST(Describe, MatchesContainerStatistics) {
+  ev::Vector vector;
+  for(int i = 0; i < 53; i++) {
+    vector.emplace_back((7 * i) % 31, 100 - (3 * i) % 17, 1e6 + 0.5 * i, i % 3 != 0);
+  }
+  const ev::Description d = ev::describe(vector);
+  EXPECT_EQ(d.size, vector.size());
+  EXPECT_DOUBLE_EQ(d.mean.x, vector.mean().x);
+  EXPECT_DOUBLE_EQ(d.mean.y, vector.mean().y);
+  EXPECT_NEAR(d.mean.t, vector.meanTime(), 1e-6);
+  EXPECT_EQ(d.mean.p, vector.mean().p);
+  EXPECT_DOUBLE_EQ(d.duration(), vector.duration());
+  EXPECT_DOUBLE_EQ(d.ratio, 35.0 / 53.0);
+  EXPECT_EQ(d.box, cv::Rect2d(0, 84, 30, 16));
+
+  double vx = 0;
+  double vy = 0;
+  for(const ev::Event &e : vector) {
+    vx += (e.x - d.mean.x) * (e.x - d.mean.x);
+    vy += (e.y - d.mean.y) * (e.y - d.mean.y);
+  }
+  EXPECT_NEAR(d.variance.x, vx / 53, 1e-9);
+  EXPECT_NEAR(d.spatialVariance(), (vx + vy) / 53, 1e-9);
+
+  const ev::Description b = ev::describe(ev::EventBatch(vector));
+  ev::Deque deque(vector.begin(), vector.end());
+  const ev::Description q = ev::describe(deque);
+  EXPECT_DOUBLE_EQ(b.mean.t, d.mean.t);
+  EXPECT_DOUBLE_EQ(b.variance.y, d.variance.y);
+  EXPECT_DOUBLE_EQ(q.mean.x, d.mean.x);
+  EXPECT_EQ(q.box, d.box);
+  EXPECT_EQ(ev::describe(ev::Vector()).size, 0U);
+}
+
+TEST(Describe, Threads) {
+  ev::CircularBuffer buffer(3 * ev::Description::MIN_EVENTS_PER_THREAD);
+  for(std::size_t i = 0; i < buffer.capacity() + 5; i++) {
+    buffer.emplace_back(static_cast<int>(i % 640), static_cast<int>(i % 480), static_cast<double>(i), i % 5 == 0);
+  }
+  const ev::Description single = ev::describe(buffer, 1);
+  const ev::Description multi = ev::describe(buffer, 3);
+  EXPECT_EQ(single.size, multi.size);
+  EXPECT_NEAR(single.mean.x, multi.mean.x, 1e-9);
+  EXPECT_NEAR(single.mean.t, multi.mean.t, 1e-6);
+  EXPECT_NEAR(single.variance.y, multi.variance.y, 1e-6);
+  EXPECT_EQ(single.box, multi.box);
+  EXPECT_DOUBLE_EQ(single.tMin, 5.0);
+  EXPECT_DOUBLE_EQ(single.ratio, multi.ratio);
+
+  ev::Array<2> array;
+  array[0] = ev::Event(1, 2, 3.0, true);
+  array[1] = ev::Event(3, 4, 5.0, false);
+  EXPECT_DOUBLE_EQ(ev::describe(array).rate(), 1.0);
+}
+
+TEST(SpscRing, PushPop) {
+  ev::SpscRing ring(3);
+  EXPECT_EQ(ring.capacity(), 4U);
+  EXPECT_TRUE(ring.empty());
+  ev::Event e;
+  EXPECT_FALSE(ring.pop(e));
+  for(int i = 0; i < 4; i++) {
+    EXPECT_TRUE(ring.emplace(i, 2 * i, 1.0 + i, i % 2 == 0));
+  }
+  EXPECT_FALSE(ring.push(ev::Event(9, 9, 9.0, true)));
+  ASSERT_TRUE(ring.pop(e));
+  EXPECT_EQ(e, ev::Event(0, 0, 1.0, true));
+  EXPECT_TRUE(ring.emplace(4, 8, 5.0, true));
+  EXPECT_EQ(ring.size(), 4U);
+  EXPECT_EQ(ring.front(), ev::Event(1, 2, 2.0, false));
+  EXPECT_EQ(ring.back(), ev::Event(4, 8, 5.0, true));
+  EXPECT_DOUBLE_EQ(ring.duration(), 3.0);
+  EXPECT_DOUBLE_EQ(ring.rate(), 4.0 / 3.0);
+  EXPECT_DOUBLE_EQ(ring.mean().x, 2.5);
+  EXPECT_DOUBLE_EQ(ring.meanPoint().y, 5.0);
+  EXPECT_DOUBLE_EQ(ring.meanTime(), 3.5);
+  EXPECT_DOUBLE_EQ(ring.midTime(), 3.5);
+}
+
+TEST(SpscRing, Bulk) {
+  ev::Vector vector;
+  for(int i = 0; i < 10; i++) {
+    vector.emplace_back(i, i, static_cast<double>(i), true);
+  }
+  ev::SpscRing ring(8);
+  EXPECT_EQ(ring.push_n(vector.begin(), 5), 5U);
+  ev::Vector out(11);
+  EXPECT_EQ(ring.pop_n(out.begin(), 3), 3U);
+  EXPECT_EQ(ring.push_n(vector.begin() + 5, 5), 5U);
+  EXPECT_EQ(ring.push_n(vector.begin(), 10), 1U);
+  EXPECT_EQ(ring.pop_n(out.begin() + 3, 10), 8U);
+  EXPECT_TRUE(ring.empty());
+  vector.push_back(vector[0]);
+  EXPECT_EQ(out, vector);
+}
+
+TEST(SpscRing, ProducerConsumer) {
+  constexpr int N = 20000;
+  ev::SpscRing ring(64);
+  std::thread producer([&ring]() {
+    ev::Vector chunk;
+    for(int i = 0; i < N;) {
+      std::size_t n;
+      if(i % 3 == 0) {
+        n = ring.emplace(i % 640, i % 480, static_cast<double>(i), true) ? 1 : 0;
+      } else {
+        chunk.clear();
+        for(int j = i; j < N && j < i + 7; j++) {
+          chunk.emplace_back(j % 640, j % 480, static_cast<double>(j), true);
+        }
+        n = ring.push_n(chunk.begin(), chunk.size());
+      }
+      if(n == 0) {
+        std::this_thread::yield();
+      }
+      i += static_cast<int>(n);
+    }
+  });
+  std::vector<ev::Event> received;
+  ev::Event buffer[5];
+  while(received.size() < static_cast<std::size_t>(N)) {
+    const std::size_t n = ring.pop_n(buffer, 5);
+    if(n == 0) {
+      std::this_thread::yield();
+    }
+    received.insert(received.end(), buffer, buffer + n);
+  }
+  producer.join();
+  bool ordered = true;
+  for(int i = 0; i < N; i++) {
+    ordered &= received[i] == ev::Event(i % 640, i % 480, static_cast<double>(i), true);
+  }
+  EXPECT_TRUE(ordered);
+  EXPECT_TRUE(ring.empty());
+}
+
+TEST(ChunkQueue, TryPushPop) {
+  ev::ChunkQueue queue(3, 2);
+  EXPECT_EQ(queue.capacity(), 4U);
+  EXPECT_EQ(queue.chunkSize(), 2U);
+  ev::Vector chunk;
+  EXPECT_FALSE(queue.try_pop(chunk));
+  for(int i = 0; i < 4; i++) {
+    chunk.emplace_back(i, i, static_cast<double>(i), true);
+    ASSERT_TRUE(queue.try_push(chunk));
+    EXPECT_TRUE(chunk.empty());
+  }
+  chunk.emplace_back(4, 4, 4.0, true);
+  EXPECT_FALSE(queue.try_push(chunk));
+  EXPECT_EQ(chunk.size(), 1U);
+  EXPECT_EQ(queue.size(), 4U);
+  ev::Vector out;
+  ASSERT_TRUE(queue.try_pop(out));
+  EXPECT_EQ(out, ev::Vector(1, ev::Event(0, 0, 0.0, true)));
+  EXPECT_TRUE(queue.try_push(chunk));
+  queue.close();
+  EXPECT_TRUE(queue.closed());
+  EXPECT_FALSE(queue.push(chunk));
+  for(int i = 1; i < 5; i++) {
+    ASSERT_TRUE(queue.pop(out));
+    EXPECT_EQ(out[0].x, i);
+  }
+  EXPECT_FALSE(queue.pop(out));
+}
+
+TEST(ChunkQueue, MultiProducerMultiConsumer) {
+  constexpr int PRODUCERS = 3;
+  constexpr int CONSUMERS = 2;
+  constexpr int CHUNKS = 2000;
+  ev::ChunkQueue queue(8, 16);
+  std::vector<std::thread> producers;
+  for(int k = 0; k < PRODUCERS; k++) {
+    producers.emplace_back([&queue, k]() {
+      ev::Vector chunk;
+      for(int i = 0; i < CHUNKS; i++) {
+        for(int j = 0; j < 1 + i % 16; j++) {
+          chunk.emplace_back(k, i, static_cast<double>(j), true);
+        }
+        ASSERT_TRUE(queue.push(chunk));
+      }
+    });
+  }
+  std::vector<std::vector<int>> received(CONSUMERS, std::vector<int>(PRODUCERS * CHUNKS, 0));
+  std::vector<std::thread> consumers;
+  for(int c = 0; c < CONSUMERS; c++) {
+    consumers.emplace_back([&queue, &received, c]() {
+      ev::Vector chunk;
+      while(queue.pop(chunk)) {
+        ASSERT_FALSE(chunk.empty());
+        const int i = chunk[0].y;
+        EXPECT_EQ(chunk.size(), static_cast<std::size_t>(1 + i % 16));
+        received[c][chunk[0].x * CHUNKS + i]++;
+      }
+    });
+  }
+  for(std::thread &t : producers) {
+    t.join();
+  }
+  queue.close();
+  for(std::thread &t : consumers) {
+    t.join();
+  }
+  bool once = true;
+  for(int i = 0; i < PRODUCERS * CHUNKS; i++) {
+    once &= received[0][i] + received[1][i] == 1;
+  }
+  EXPECT_TRUE(once);
+}
+
+TEST(ChunkQueue, SingleSlot) {
+  ev::ChunkQueue queue(1);
+  EXPECT_EQ(queue.capacity(), 2U);
+  ev::Vector chunk;
+  for(int i = 0; i < 2; i++) {
+    chunk.emplace_back(i, i, static_cast<double>(i), true);
+    ASSERT_TRUE(queue.try_push(chunk));
+  }
+  chunk.emplace_back(2, 2, 2.0, true);
+  EXPECT_FALSE(queue.try_push(chunk));
+  ev::Vector out;
+  for(int i = 0; i < 2; i++) {
+    ASSERT_TRUE(queue.try_pop(out));
+    EXPECT_EQ(out[0].x, i);
+  }
+  EXPECT_FALSE(queue.try_pop(out));
+}
+
+TEST(ChunkQueue, EmptyChunkSize) {
+  const ev::ChunkQueue queue(4, 0);
+  EXPECT_EQ(queue.chunkSize(), 1U);
+}
+
+TEST(ChunkQueue, CloseWhileProducing) {
+  constexpr int PRODUCERS = 3;
+  ev::ChunkQueue queue(4, 1);
+  std::atomic<int> pushed{0};
+  std::vector<std::thread> producers;
+  for(int k = 0; k < PRODUCERS; k++) {
+    producers.emplace_back([&queue, &pushed]() {
+      ev::Vector chunk;
+      for(;;) {
+        chunk.emplace_back(0, 0, 0.0, true);
+        if(!queue.push(chunk)) {
+          return;
+        }
+        pushed++;
+      }
+    });
+  }
+  int popped = 0;
+  ev::Vector chunk;
+  for(int i = 0; i < 1000; i++) {
+    ASSERT_TRUE(queue.pop(chunk));
+    popped++;
+  }
+  queue.close();
+  while(queue.pop(chunk)) {
+    popped++;
+  }
+  for(std::thread &t : producers) {
+    t.join();
+  }
+  EXPECT_EQ(popped, pushed.load());
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST(TimeWindow, Eviction) {
+  ev::TimeWindow window(10.0);
+  ev::Mat::Counter counter(4, 4);
+  counter.clear();
+  ev::Vector evicted;
+  window.onEvict([&](const ev::Event &e) {
+    evicted.push_back(e);
+    counter.remove(e);
+  });
+  for(int i = 0; i < 20; i++) {
+    const ev::Event e(i % 4, (i / 4) % 4, static_cast<double>(i), i % 3 != 0);
+    counter.insert(e);
+    window.push_back(e);
+  }
+  ASSERT_EQ(window.size(), 11U);
+  EXPECT_EQ(evicted.size(), 9U);
+  EXPECT_DOUBLE_EQ(window.front().t, 9.0);
+  EXPECT_DOUBLE_EQ(window.duration(), 10.0);
+  EXPECT_DOUBLE_EQ(window.meanTime(), 14.0);
+
+  ev::Mat::Counter expected(4, 4);
+  expected.clear();
+  for(const ev::Event &e : window) {
+    expected.insert(e);
+  }
+  for(int y = 0; y < 4; y++) {
+    for(int x = 0; x < 4; x++) {
+      EXPECT_EQ(counter(y, x), expected(y, x));
+    }
+  }
+
+  const ev::Deque reference(window.begin(), window.end());
+  EXPECT_DOUBLE_EQ(window.mean().x, reference.mean().x);
+  EXPECT_DOUBLE_EQ(window.meanPoint().y, reference.meanPoint().y);
+  EXPECT_EQ(window.mean().p, reference.mean().p);
+
+  window.setWindow(2.5);
+  EXPECT_EQ(window.size(), 3U);
+  EXPECT_EQ(evicted.size(), 17U);
+  window.clear();
+  EXPECT_TRUE(window.empty());
+  EXPECT_EQ(evicted.size(), 17U);
+}
+
+TEST(TimeWindow, Append) {
+  ev::Vector vector;
+  for(int i = 0; i < 100; i++) {
+    vector.emplace_back(i, i, 0.5 * i, true);
+  }
+  ev::TimeWindow window(5.0);
+  std::size_t evicted = 0;
+  window.onEvict([&evicted](const ev::Event &) { evicted++; });
+  window.append(vector.begin(), vector.begin() + 50);
+  window.append(vector.begin() + 50, vector.end());
+  EXPECT_EQ(window.size(), 11U);
+  EXPECT_EQ(evicted, 89U);
+  EXPECT_EQ(window.back(), vector.back());
+  EXPECT_EQ(window[0], vector[89]);
+  EXPECT_DOUBLE_EQ(ev::describe(window).mean.x, 94.0);
+}
+
+TEST(EventSpan, Slicing) {
+  ev::Vector vector;
+  for(int i = 0; i < 100; i++) {
+    vector.emplace_back(i, 2 * i, 0.5 * i, i % 2 == 0);
+  }
+  const ev::EventSpan span = vector.slice_t(10.0, 20.0);
+  ASSERT_EQ(span.size(), 20U);
+  EXPECT_EQ(span.data(), vector.data() + 20);
+  EXPECT_EQ(span.front(), vector[20]);
+  EXPECT_EQ(span.back(), vector[39]);
+  EXPECT_TRUE(vector.slice_t(20.0, 10.0).empty());
+  EXPECT_TRUE(vector.slice_t(60.0, 70.0).empty());
+  EXPECT_EQ(vector.slice_t(-1.0, 1e9).size(), vector.size());
+  EXPECT_EQ(span.slice_t(12.0, 13.0).size(), 2U);
+
+  EXPECT_EQ(vector.slice_n(95, 10).size(), 5U);
+  EXPECT_TRUE(vector.slice_n(200, 10).empty());
+  EXPECT_EQ(span.slice_n(5, 2).front(), vector[25]);
+
+  const ev::Vector copy(span.begin(), span.end());
+  EXPECT_DOUBLE_EQ(span.duration(), copy.duration());
+  EXPECT_DOUBLE_EQ(span.meanTime(), copy.meanTime());
+  EXPECT_DOUBLE_EQ(span.midTime(), copy.midTime());
+  EXPECT_DOUBLE_EQ(span.meanPoint().y, copy.meanPoint().y);
+  EXPECT_EQ(span.mean().p, copy.mean().p);
+  EXPECT_DOUBLE_EQ(ev::describe(span).mean.x, copy.meanPoint().x);
+
+  ev::Array_<int, 8> array;
+  for(std::size_t i = 0; i < array.size(); i++) {
+    array[i] = ev::Event(0, 0, static_cast<double>(i), true);
+  }
+  EXPECT_EQ(array.slice_t(2.0, 5.0).size(), 3U);
+}
+
+TEST(EventSpan, FilterAndEncode) {
+  ev::Vector vector;
+  for(int i = 0; i < 100; i++) {
+    vector.emplace_back(i % 10, i / 10, static_cast<double>(i), i % 2 == 0);
+  }
+  const ev::EventSpan span = vector.slice_t(30.0, 70.0);
+  const ev::Vector copy(span.begin(), span.end());
+  const ev::Rect rect(2, 2, 5, 5);
+  EXPECT_EQ(ev::filter(rect, span), ev::filter(rect, copy));
+
+  std::vector<uint64_t> data;
+  ev::raw::encode(span, data);
+  std::vector<uint64_t> expected;
+  ev::raw::encode(copy, expected);
+  EXPECT_EQ(data, expected);
+}
+
+TEST(Pmr, ZeroAllocationSteadyState) {
+  constexpr int FRAMES = 20;
+  constexpr int EVENTS = 10000;
+  std::size_t before{0};
+
+  ev::Vector vector;
+  const ev::Event *data{nullptr};
+  for(int frame = 0; frame < FRAMES; frame++) {
+    vector.clear();
+    for(int i = 0; i < EVENTS; i++) {
+      vector.emplace_back(i % 640, i % 480, static_cast<double>(i), i % 2 == 0);
+    }
+    if(frame == FRAMES / 2) {
+      data = vector.data();
+    }
+  }
+  EXPECT_EQ(vector.data(), data);
+
+  CountingResource heap;
+  ev::pmr::Pool pool(&heap);
+  ev::pmr::Deque deque(&pool);
+  ev::pmr::Queue queue(&pool);
+  for(int frame = 0; frame < FRAMES; frame++) {
+    if(frame == FRAMES / 2) {
+      before = heap.allocations;
+    }
+    for(int i = 0; i < EVENTS; i++) {
+      deque.emplace_back(i % 640, i % 480, static_cast<double>(i), i % 2 == 0);
+      queue.emplace(i % 640, i % 480, static_cast<double>(i), i % 2 == 0);
+    }
+    while(!queue.empty()) {
+      deque.pop_front();
+      queue.pop();
+    }
+  }
+  EXPECT_GT(before, 0U);
+  EXPECT_EQ(heap.allocations, before);
+
+  CountingResource upstream;
+  std::vector<std::byte> buffer(1 << 20);
+  ev::pmr::Arena arena(buffer.data(), buffer.size(), &upstream);
+  for(int frame = 0; frame < FRAMES; frame++) {
+    {
+      ev::pmr::Vector events(&arena);
+      events.reserve(EVENTS);
+      for(int i = 0; i < EVENTS; i++) {
+        events.emplace_back(i % 640, i % 480, static_cast<double>(i), i % 2 == 0);
+      }
+      ASSERT_EQ(events.size(), static_cast<std::size_t>(EVENTS));
+    }
+    arena.release();
+  }
+  EXPECT_EQ(upstream.allocations, 0U);
+}
+
+TEST(Pmr, Interoperability) {
+  ev::pmr::Pool pool;
+  ev::pmr::Vector vector(&pool);
+  for(int i = 0; i < 10; i++) {
+    vector.emplace_back(i, i, static_cast<double>(i), true);
+  }
+  vector.track();
+  EXPECT_DOUBLE_EQ(vector.meanTime(), 4.5);
+  EXPECT_EQ(ev::EventSpan(vector).size(), 10U);
+  EXPECT_EQ(vector.slice_t(2.0, 5.0).size(), 3U);
+  EXPECT_DOUBLE_EQ(ev::describe(vector).mean.x, 4.5);
+  EXPECT_EQ(ev::filter(ev::Rect(0, 0, 5, 5), vector).size(), 5U);
+}
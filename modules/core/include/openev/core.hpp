@@ -6,7 +6,13 @@
 #ifndef OPENEV_CORE_HPP
 #define OPENEV_CORE_HPP
 
+#include "openev/core/codec.hpp"
 #include "openev/core/matrices.hpp"
+#include "openev/core/roi.hpp"
+#include "openev/core/sensor.hpp"
+#include "openev/core/simd.hpp"
+#include "openev/core/traits.hpp"
 #include "openev/core/types.hpp"
+#include "openev/core/unwrap.hpp"
 
 #endif // OPENEV_CORE_HPP
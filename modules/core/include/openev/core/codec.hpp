@@ -0,0 +1,385 @@
+/*!
+\file codec.hpp
+\brief Encoding and decoding of raw 64-bit events.
+\author Raul Tapia
+*/
+#ifndef OPENEV_CORE_CODEC_HPP
+#define OPENEV_CORE_CODEC_HPP
+
+#include "openev/core/types.hpp"
+#include "openev/core/unwrap.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace ev {
+namespace raw {
+/*!
+\brief Raw event layout, as provided by ev::Davis::getEventRaw.
+
+\code{.unparsed}
+Mask for x: 11111111111111100000000000000000 00000000000000000000000000000000
+Mask for y: 00000000000000011111111111111100 00000000000000000000000000000000
+Mask for p: 00000000000000000000000000000010 00000000000000000000000000000000
+Mask for v: 00000000000000000000000000000001 00000000000000000000000000000000
+Mask for t: 00000000000000000000000000000000 11111111111111111111111111111111
+\endcode
+
+Bit v is the valid mark of the camera driver. It is always set by the encoder and ignored by the decoder.
+*/
+enum Layout : uint8_t {
+  SHIFT_X = 49,
+  SHIFT_Y = 34,
+  SHIFT_P = 33,
+  SHIFT_VALID = 32
+};
+
+constexpr uint32_t MASK_XY = 0x7FFFU; /*!< Mask for 15-bit spatial coordinates */
+
+/*!
+\brief True if the codec has been compiled with AVX2 kernels.
+*/
+#if defined(__AVX2__)
+constexpr bool AVX2 = true;
+#else
+constexpr bool AVX2 = false;
+#endif
+
+/*! \cond INTERNAL */
+constexpr std::size_t BLOCK = 8;
+
+inline void encodeBlock(const int32_t *x, const int32_t *y, const uint32_t *t, const uint8_t *p, uint64_t *out) {
+#if defined(__AVX2__)
+  const __m256i mask = _mm256_set1_epi32(static_cast<int>(MASK_XY));
+  const __m256i vx = _mm256_and_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(x)), mask);
+  const __m256i vy = _mm256_and_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(y)), mask);
+  const __m256i vp = _mm256_and_si256(_mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(p))), _mm256_set1_epi32(1));
+  const __m256i vt = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(t));
+  __m256i hi = _mm256_slli_epi32(vx, SHIFT_X - 32);
+  hi = _mm256_or_si256(hi, _mm256_slli_epi32(vy, SHIFT_Y - 32));
+  hi = _mm256_or_si256(hi, _mm256_slli_epi32(vp, SHIFT_P - 32));
+  hi = _mm256_or_si256(hi, _mm256_set1_epi32(1 << (SHIFT_VALID - 32)));
+  const __m256i lo = _mm256_unpacklo_epi32(vt, hi);
+  const __m256i up = _mm256_unpackhi_epi32(vt, hi);
+  _mm256_storeu_si256(reinterpret_cast<__m256i *>(out), _mm256_permute2x128_si256(lo, up, 0x20));
+  _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + 4), _mm256_permute2x128_si256(lo, up, 0x31));
+#else
+  for(std::size_t i = 0; i < BLOCK; i++) {
+    out[i] = (static_cast<uint64_t>(static_cast<uint32_t>(x[i]) & MASK_XY) << SHIFT_X) | (static_cast<uint64_t>(static_cast<uint32_t>(y[i]) & MASK_XY) << SHIFT_Y) | (static_cast<uint64_t>(p[i] & 1U) << SHIFT_P) | (uint64_t{1} << SHIFT_VALID) | t[i];
+  }
+#endif
+}
+
+inline void decodeBlock(const uint64_t *in, int32_t *x, int32_t *y, uint32_t *t, uint8_t *p) {
+#if defined(__AVX2__)
+  const __m256i split = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+  const __m256i a = _mm256_permutevar8x32_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(in)), split);
+  const __m256i b = _mm256_permutevar8x32_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(in + 4)), split);
+  const __m256i vt = _mm256_permute2x128_si256(a, b, 0x20);
+  const __m256i hi = _mm256_permute2x128_si256(a, b, 0x31);
+  const __m256i mask = _mm256_set1_epi32(static_cast<int>(MASK_XY));
+  _mm256_storeu_si256(reinterpret_cast<__m256i *>(t), vt);
+  _mm256_storeu_si256(reinterpret_cast<__m256i *>(x), _mm256_and_si256(_mm256_srli_epi32(hi, SHIFT_X - 32), mask));
+  _mm256_storeu_si256(reinterpret_cast<__m256i *>(y), _mm256_and_si256(_mm256_srli_epi32(hi, SHIFT_Y - 32), mask));
+  const __m256i vp = _mm256_and_si256(_mm256_srli_epi32(hi, SHIFT_P - 32), _mm256_set1_epi32(1));
+  const __m256i bytes = _mm256_packs_epi16(_mm256_packs_epi32(vp, vp), _mm256_setzero_si256());
+  const uint32_t p0 = static_cast<uint32_t>(_mm256_extract_epi32(bytes, 0));
+  const uint32_t p1 = static_cast<uint32_t>(_mm256_extract_epi32(bytes, 4));
+  std::memcpy(p, &p0, sizeof(p0));
+  std::memcpy(p + 4, &p1, sizeof(p1));
+#else
+  for(std::size_t i = 0; i < BLOCK; i++) {
+    x[i] = static_cast<int32_t>((in[i] >> SHIFT_X) & MASK_XY);
+    y[i] = static_cast<int32_t>((in[i] >> SHIFT_Y) & MASK_XY);
+    p[i] = static_cast<uint8_t>((in[i] >> SHIFT_P) & 1U);
+    t[i] = static_cast<uint32_t>(in[i]);
+  }
+#endif
+}
+
+template <typename T>
+inline int32_t toCoordinate(const T value) {
+  if constexpr(std::is_floating_point_v<T>) {
+    return static_cast<int32_t>(std::lround(value));
+  } else {
+    return static_cast<int32_t>(value);
+  }
+}
+
+template <typename Tt>
+inline uint32_t toTicks(const Tt value, const double scale) {
+  if constexpr(std::is_floating_point_v<Tt>) {
+    return static_cast<uint32_t>(std::llround(static_cast<double>(value) / scale));
+  } else {
+    return static_cast<uint32_t>(scale == 1.0 ? static_cast<int64_t>(value) : std::llround(static_cast<double>(value) / scale));
+  }
+}
+/*! \endcond */
+
+/*!
+\brief Encode an event into the raw 64-bit layout.
+\param e Event
+\param scale Duration of one raw timestamp tick in the units of the event timestamps (e.g., 1e-6 if event timestamps are in seconds and raw timestamps in microseconds)
+\return Raw event
+\note Coordinates are truncated to 15 bits and timestamps to 32 bits (i.e., they wrap around).
+*/
+template <typename T, typename Tt>
+[[nodiscard]] inline uint64_t encode(const Event_<T, Tt> &e, const double scale = 1.0) {
+  return (static_cast<uint64_t>(static_cast<uint32_t>(toCoordinate(e.x)) & MASK_XY) << SHIFT_X) | (static_cast<uint64_t>(static_cast<uint32_t>(toCoordinate(e.y)) & MASK_XY) << SHIFT_Y) | (static_cast<uint64_t>(e.p) << SHIFT_P) | (uint64_t{1} << SHIFT_VALID) | toTicks(e.t, scale);
+}
+
+/*!
+\brief Encode a sequence of events into the raw 64-bit layout.
+\param events Pointer to the first event
+\param n Number of events
+\param out Pointer to the output buffer (n elements)
+\param scale Duration of one raw timestamp tick in the units of the event timestamps
+*/
+template <typename T, typename Tt>
+inline void encode(const Event_<T, Tt> *events, const std::size_t n, uint64_t *out, const double scale = 1.0) {
+  int32_t x[BLOCK];
+  int32_t y[BLOCK];
+  uint32_t t[BLOCK];
+  uint8_t p[BLOCK];
+  std::size_t i = 0;
+  for(; i + BLOCK <= n; i += BLOCK) {
+    for(std::size_t k = 0; k < BLOCK; k++) {
+      x[k] = toCoordinate(events[i + k].x);
+      y[k] = toCoordinate(events[i + k].y);
+      t[k] = toTicks(events[i + k].t, scale);
+      p[k] = static_cast<uint8_t>(events[i + k].p);
+    }
+    encodeBlock(x, y, t, p, out + i);
+  }
+  for(; i < n; i++) {
+    out[i] = encode(events[i], scale);
+  }
+}
+
+/*!
+\brief Encode columns of event data into the raw 64-bit layout.
+\param x Column of x coordinates
+\param y Column of y coordinates
+\param t Column of timestamps
+\param p Column of polarities (0 or 1)
+\param n Number of events
+\param out Pointer to the output buffer (n elements)
+\param scale Duration of one raw timestamp tick in the units of the event timestamps
+*/
+template <typename T, typename Tt>
+inline void encode(const T *x, const T *y, const Tt *t, const uint8_t *p, const std::size_t n, uint64_t *out, const double scale = 1.0) {
+  int32_t bx[BLOCK];
+  int32_t by[BLOCK];
+  uint32_t bt[BLOCK];
+  std::size_t i = 0;
+  for(; i + BLOCK <= n; i += BLOCK) {
+    for(std::size_t k = 0; k < BLOCK; k++) {
+      bx[k] = toCoordinate(x[i + k]);
+      by[k] = toCoordinate(y[i + k]);
+      bt[k] = toTicks(t[i + k], scale);
+    }
+    encodeBlock(bx, by, bt, p + i, out + i);
+  }
+  for(; i < n; i++) {
+    out[i] = encode(Event_<T, Tt>(x[i], y[i], t[i], static_cast<bool>(p[i])), scale);
+  }
+}
+
+/*!
+\brief Encode a sequence of events into the raw 64-bit layout.
+\param events Event vector (e.g., Vector_, with any allocator)
+\param out Output buffer. It is resized to the number of events.
+\param scale Duration of one raw timestamp tick in the units of the event timestamps
+*/
+template <typename T, typename Tt, typename Alloc>
+inline void encode(const std::vector<Event_<T, Tt>, Alloc> &events, std::vector<uint64_t> &out, const double scale = 1.0) {
+  out.resize(events.size());
+  encode(events.data(), events.size(), out.data(), scale);
+}
+
+/*!
+\brief This class implements a stateful decoder for raw 64-bit events.
+
+Raw timestamps only have 32 bits, so they wrap around periodically. The decoder unwraps them with a TimestampUnwrapper_: whenever a raw timestamp is lower than the previous one by more than half the period, a wrap-around is assumed and one period is added to the following timestamps. Smaller backward steps are out-of-order events: they keep their timestamp and are counted (see reordered()). The state persists across calls, so a stream can be decoded in chunks.
+
+Coordinates and polarities are extracted with AVX2 instructions when the library is compiled with AVX2 support (e.g., -mavx2 or -march=native), and with portable scalar code otherwise.
+
+\code{.cpp}
+ev::raw::Decoder decoder(1e-6); // Raw timestamps in microseconds, event timestamps in seconds
+std::vector<uint64_t> data;
+ev::Vector events;
+while(davis.ok()) {
+  data.clear();
+  davis.getEventRaw(data);
+  decoder.decode(data, events);
+}
+\endcode
+*/
+class Decoder {
+public:
+  /*!
+  \brief Constructor.
+  \param scale Duration of one raw timestamp tick in the units of the decoded timestamps (e.g., 1e-6 to decode microseconds into seconds)
+  \param period Period of the raw timestamps, i.e., the value added to the timestamps after each wrap-around
+  */
+  explicit Decoder(const double scale = 1.0, const uint64_t period = uint64_t{1} << 32) : scale_{scale}, unwrapper_{static_cast<int64_t>(period)} {};
+
+  /*!
+  \brief Decode a raw event.
+  \param data Raw event
+  \return Decoded event
+  */
+  template <typename T = int, typename Tt = double>
+  [[nodiscard]] inline Event_<T, Tt> decode(const uint64_t data) {
+    return {static_cast<T>((data >> SHIFT_X) & MASK_XY), static_cast<T>((data >> SHIFT_Y) & MASK_XY), convert<Tt>(unwrap(static_cast<uint32_t>(data))), static_cast<bool>((data >> SHIFT_P) & 1U)};
+  }
+
+  /*!
+  \brief Decode a sequence of raw events.
+  \param data Pointer to the first raw event
+  \param n Number of raw events
+  \param out Pointer to the output events (n elements)
+  */
+  template <typename T, typename Tt>
+  inline void decode(const uint64_t *data, const std::size_t n, Event_<T, Tt> *out) {
+    int32_t x[BLOCK];
+    int32_t y[BLOCK];
+    uint32_t t[BLOCK];
+    uint8_t p[BLOCK];
+    int64_t ticks[BLOCK];
+    std::size_t i = 0;
+    for(; i + BLOCK <= n; i += BLOCK) {
+      decodeBlock(data + i, x, y, t, p);
+      unwrap(t, ticks);
+      for(std::size_t k = 0; k < BLOCK; k++) {
+        out[i + k].x = static_cast<T>(x[k]);
+        out[i + k].y = static_cast<T>(y[k]);
+        out[i + k].t = convert<Tt>(ticks[k]);
+        out[i + k].p = static_cast<bool>(p[k]);
+      }
+    }
+    for(; i < n; i++) {
+      out[i] = decode<T, Tt>(data[i]);
+    }
+  }
+
+  /*!
+  \brief Decode a sequence of raw events into columns.
+  \param data Pointer to the first raw event
+  \param n Number of raw events
+  \param x Column of x coordinates (n elements)
+  \param y Column of y coordinates (n elements)
+  \param t Column of timestamps (n elements)
+  \param p Column of polarities (n elements)
+  */
+  template <typename T, typename Tt>
+  inline void decode(const uint64_t *data, const std::size_t n, T *x, T *y, Tt *t, uint8_t *p) {
+    int32_t bx[BLOCK];
+    int32_t by[BLOCK];
+    uint32_t bt[BLOCK];
+    int64_t ticks[BLOCK];
+    std::size_t i = 0;
+    for(; i + BLOCK <= n; i += BLOCK) {
+      if constexpr(std::is_same_v<T, int32_t>) {
+        decodeBlock(data + i, x + i, y + i, bt, p + i);
+      } else {
+        decodeBlock(data + i, bx, by, bt, p + i);
+        for(std::size_t k = 0; k < BLOCK; k++) {
+          x[i + k] = static_cast<T>(bx[k]);
+          y[i + k] = static_cast<T>(by[k]);
+        }
+      }
+      unwrap(bt, ticks);
+      for(std::size_t k = 0; k < BLOCK; k++) {
+        t[i + k] = convert<Tt>(ticks[k]);
+      }
+    }
+    for(; i < n; i++) {
+      const Event_<T, Tt> e = decode<T, Tt>(data[i]);
+      x[i] = e.x;
+      y[i] = e.y;
+      t[i] = e.t;
+      p[i] = static_cast<uint8_t>(e.p);
+    }
+  }
+
+  /*!
+  \brief Decode a sequence of raw events and append them to an event vector.
+  \param data Raw events
+  \param out Event vector (e.g., std::vector or Vector_, with any allocator) to which the decoded events are added. Events are added with its own emplace_back(), so that the statistics tracked by Vector_ stay up to date.
+  */
+  template <typename Container>
+  inline void decode(const std::vector<uint64_t> &data, Container &out) {
+    using T = decltype(Container::value_type::x);
+    using Tt = decltype(Container::value_type::t);
+    out.reserve(out.size() + data.size());
+    int32_t x[BLOCK];
+    int32_t y[BLOCK];
+    uint32_t t[BLOCK];
+    uint8_t p[BLOCK];
+    int64_t ticks[BLOCK];
+    std::size_t i = 0;
+    for(; i + BLOCK <= data.size(); i += BLOCK) {
+      decodeBlock(data.data() + i, x, y, t, p);
+      unwrap(t, ticks);
+      for(std::size_t k = 0; k < BLOCK; k++) {
+        out.emplace_back(static_cast<T>(x[k]), static_cast<T>(y[k]), convert<Tt>(ticks[k]), static_cast<bool>(p[k]));
+      }
+    }
+    for(; i < data.size(); i++) {
+      out.emplace_back(decode<T, Tt>(data[i]));
+    }
+  }
+
+  /*!
+  \brief Reset the wrap-around state.
+  */
+  inline void reset() { unwrapper_.reset(); }
+
+  /*!
+  \brief Current timestamp offset due to wrap-arounds, in raw ticks.
+  \return Offset
+  */
+  [[nodiscard]] inline uint64_t offset() const { return static_cast<uint64_t>(unwrapper_.offset()); }
+
+  /*!
+  \brief Number of out-of-order events decoded so far.
+  \return Number of reordered events
+  */
+  [[nodiscard]] inline std::size_t reordered() const { return unwrapper_.reordered(); }
+
+private:
+  double scale_;
+  TimestampUnwrapperl unwrapper_;
+
+  inline int64_t unwrap(const uint32_t t) {
+    int64_t ticks = t;
+    unwrapper_(&ticks, 1);
+    return ticks;
+  }
+
+  inline void unwrap(const uint32_t *t, int64_t *ticks) {
+    std::copy(t, t + BLOCK, ticks);
+    unwrapper_(ticks, BLOCK);
+  }
+
+  template <typename Tt>
+  [[nodiscard]] inline Tt convert(const int64_t ticks) const {
+    if constexpr(std::is_floating_point_v<Tt>) {
+      return static_cast<Tt>(static_cast<double>(ticks) * scale_);
+    } else {
+      return scale_ == 1.0 ? static_cast<Tt>(ticks) : static_cast<Tt>(std::llround(static_cast<double>(ticks) * scale_));
+    }
+  }
+};
+} // namespace raw
+} // namespace ev
+
+#endif // OPENEV_CORE_CODEC_HPP
@@ -6,29 +6,199 @@
 #ifndef OPENEV_CORE_MATRICES_HPP
 #define OPENEV_CORE_MATRICES_HPP
 
+#include "openev/core/sensor.hpp"
+#include "openev/core/simd.hpp"
+#include "openev/core/traits.hpp"
+#include <algorithm>
+#include <array>
+#include <bitset>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <limits>
+#include <optional>
 #include <opencv2/core/hal/interface.h>
 #include <opencv2/core/mat.hpp>
 #include <opencv2/core/mat.inl.hpp>
 #include <opencv2/core/traits.hpp>
+#include <opencv2/core/types.hpp>
+#include <opencv2/core/utility.hpp>
 #include <ostream>
 #include <type_traits>
+#include <vector>
 
 namespace ev {
 /*! \cond INTERNAL */
-template <typename T>
+template <typename T, typename Tt>
 class Event_;
 /*! \endcond */
 
 namespace Mat {
-template <typename Tb>
+/*!
+\brief This class implements a dirty-tile bitmap, i.e., a record of the square tiles of a matrix that have been written.
+
+The matrix is divided into tiles of tile() x tile() pixels (32 x 32 by default; the side is rounded up to a power of two). Writers call mark() for each written pixel, which costs one shift and one store. Clearing, filling, and copying can then be restricted to the dirty tiles, and forEach() or rects() give the dirty regions for partial display uploads or partial processing. Horizontally adjacent dirty tiles are merged into a single rectangle.
+\code{.cpp}
+ev::Mat::Tiles tiles(720, 1280);
+tiles.mark(640, 360);
+tiles.forEach([](const cv::Rect &rect) { upload(image(rect)); });
+\endcode
+*/
+template <typename S = Sensor<>>
+class Tiles_ {
+public:
+  Tiles_() : Tiles_(S::HEIGHT, S::WIDTH) {}
+
+  Tiles_(const int nrows, const int ncols, const int tile = 32) : rows{std::max(nrows, 0)}, cols{std::max(ncols, 0)} {
+    while((1 << shift_) < tile && shift_ < 15) {
+      shift_++;
+    }
+    gridRows_ = (rows + (1 << shift_) - 1) >> shift_;
+    gridCols_ = (cols + (1 << shift_) - 1) >> shift_;
+    flags_.assign(static_cast<std::size_t>(gridRows_) * gridCols_, 0);
+  }
+
+  explicit Tiles_(const cv::Size &size, const int tile = 32) : Tiles_(size.height, size.width, tile) {}
+
+  int rows; /*!< Number of rows of the matrix */
+  int cols; /*!< Number of columns of the matrix */
+
+  [[nodiscard]] inline cv::Size size() const { return {cols, rows}; }
+
+  /*!
+  \brief Side of the tiles.
+  \return Number of pixels
+  */
+  [[nodiscard]] inline int tile() const { return 1 << shift_; }
+
+  /*!
+  \brief Mark the tile of a pixel as dirty.
+  \param x Spatial coordinate x
+  \param y Spatial coordinate y
+  */
+  inline void mark(const int x, const int y) {
+    flags_[static_cast<std::size_t>(y >> shift_) * gridCols_ + (x >> shift_)] = 1;
+  }
+
+  /*!
+  \brief Mark all tiles as dirty.
+  */
+  inline void mark() {
+    std::fill(flags_.begin(), flags_.end(), uint8_t{1});
+  }
+
+  /*!
+  \brief Check if the tile of a pixel is dirty.
+  \param x Spatial coordinate x
+  \param y Spatial coordinate y
+  \return True if the tile is dirty
+  */
+  [[nodiscard]] inline bool dirty(const int x, const int y) const {
+    return flags_[static_cast<std::size_t>(y >> shift_) * gridCols_ + (x >> shift_)] != 0;
+  }
+
+  /*!
+  \brief Number of dirty tiles.
+  \return Number of dirty tiles
+  */
+  [[nodiscard]] inline std::size_t count() const {
+    return static_cast<std::size_t>(std::count(flags_.begin(), flags_.end(), uint8_t{1}));
+  }
+
+  /*!
+  \brief Mark all tiles as clean.
+  */
+  inline void clear() {
+    std::fill(flags_.begin(), flags_.end(), uint8_t{0});
+  }
+
+  inline Tiles_ &operator|=(const Tiles_ &other) {
+    for(std::size_t i = 0; i < flags_.size(); i++) {
+      flags_[i] |= other.flags_[i];
+    }
+    return *this;
+  }
+
+  /*!
+  \brief Call a function for each dirty region.
+  \param f Function taking a const cv::Rect&. Regions are clipped to the size of the matrix and given in row-major order.
+  */
+  template <typename F>
+  inline void forEach(F &&f) const {
+    const int side = 1 << shift_;
+    for(int ty = 0; ty < gridRows_; ty++) {
+      const uint8_t *row = flags_.data() + static_cast<std::size_t>(ty) * gridCols_;
+      for(int tx = 0; tx < gridCols_; tx++) {
+        if(!row[tx]) {
+          continue;
+        }
+        const int start = tx;
+        while(tx + 1 < gridCols_ && row[tx + 1]) {
+          tx++;
+        }
+        const int x = start * side;
+        const int y = ty * side;
+        f(cv::Rect(x, y, std::min((tx + 1) * side, cols) - x, std::min(y + side, rows) - y));
+      }
+    }
+  }
+
+  /*!
+  \brief Dirty regions.
+  \return Rectangles (see forEach())
+  */
+  [[nodiscard]] inline std::vector<cv::Rect> rects() const {
+    std::vector<cv::Rect> out;
+    forEach([&out](const cv::Rect &rect) { out.push_back(rect); });
+    return out;
+  }
+
+  /*!
+  \brief Set the dirty regions of a matrix to a value.
+  \param m Matrix with the same size
+  \param value Value
+  */
+  template <typename Tp>
+  inline void fill(cv::Mat_<Tp> &m, const Tp &value) const {
+    forEach([&m, &value](const cv::Rect &rect) {
+      for(int y = rect.y; y < rect.y + rect.height; y++) {
+        std::fill_n(m.template ptr<Tp>(y) + rect.x, rect.width, value);
+      }
+    });
+  }
+
+  /*!
+  \brief Copy the dirty regions of a matrix.
+  \param src Source matrix
+  \param dst Destination matrix with the same size and type
+  */
+  inline void copy(const cv::Mat &src, cv::Mat &dst) const {
+    forEach([&src, &dst](const cv::Rect &rect) { src(rect).copyTo(dst(rect)); });
+  }
+
+  friend std::ostream &operator<<(std::ostream &os, const Tiles_ &tiles) {
+    os << "Tiles " << tiles.cols << "x" << tiles.rows;
+    return os;
+  }
+
+private:
+  int shift_{0};
+  int gridRows_{0};
+  int gridCols_{0};
+  std::vector<uint8_t> flags_;
+};
+using Tiles = Tiles_<>;
+
+template <typename Tb, typename S = Sensor<>>
 class Binary_ : public cv::Mat_<Tb> {
 public:
   using cv::Mat_<Tb>::Mat_;
 
-  template <typename T>
-  inline Tb insert(const Event_<T> &e) {
+  Binary_() : cv::Mat_<Tb>(S::HEIGHT, S::WIDTH) {}
+
+  template <typename T, typename Tt>
+  inline Tb insert(const Event_<T, Tt> &e) {
     return set(e.x, e.y);
   }
 
@@ -38,7 +208,7 @@ public:
   }
 
   inline void clear() {
-    cv::Mat_<Tb>::setTo(0);
+    S::template fill<Tb>(*this, OFF);
   }
 
   static constexpr Tb ON = std::numeric_limits<Tb>::max();
@@ -52,22 +222,41 @@ public:
 private:
   template <typename T>
   inline Tb set(const T x, const T y) {
-    if constexpr(std::is_floating_point_v<T>) {
-      return *(this->template ptr<Tb>(std::lround(y)) + std::lround(x)) = ON;
-    } else {
-      return *(this->template ptr<Tb>(y) + x) = ON;
-    }
+    return S::at(*this, S::pixel(x), S::pixel(y)) = ON;
   }
 };
 using Binary = Binary_<uchar>;
 
-class Time : public cv::Mat_<double> {
+/*!
+\brief This class implements a matrix of timestamps (a.k.a. surface of active events).
+
+The storage type is chosen at compile time:
+- double (default): absolute timestamps.
+- float or int32_t: timestamps relative to a rolling base, in ticks, which halves the memory footprint. Relative values are kept below 2^24 (float) or 2^31 (int32_t) ticks by shifting the base when needed, so that float timestamps stay exact at tick resolution and int32_t timestamps do not overflow. When the base is shifted, timestamps older than half that range before the newest one saturate to the oldest representable value. int32_t timestamps are rounded to the nearest tick.
+
+The tick is the resolution of the timestamps in their own units (see setTick). It is 1 by default, i.e., timestamps are assumed to be integer ticks (e.g., microseconds). If timestamps are in seconds, set the tick to the sensor resolution (e.g., 1e-6); otherwise, int32_t storage rounds them to whole seconds.
+
+In all cases, zero means that no event has been inserted in the pixel.
+\code{.cpp}
+ev::Mat::Time_<ev::DynamicSensor, float> time(720, 1280); // 3.7 MB instead of 7.3 MB
+time.setTick(1e-6);                                       // Timestamps in seconds, microsecond resolution
+\endcode
+*/
+template <typename S = Sensor<>, typename Ts = double>
+class Time_ : public cv::Mat_<Ts> {
+  static_assert(std::is_same_v<Ts, double> || std::is_same_v<Ts, float> || std::is_same_v<Ts, int32_t>, "Time_: storage must be double, float, or int32_t");
+
 public:
-  using cv::Mat_<double>::Mat_;
+  using cv::Mat_<Ts>::Mat_;
 
-  template <typename T>
-  inline double insert(const Event_<T> &e) {
-    return set(e.x, e.y, e.t);
+  static constexpr bool RELATIVE = !std::is_same_v<Ts, double>;                     /*!< True if timestamps are stored relative to base() */
+  using RenderType = std::conditional_t<std::is_same_v<Ts, double>, double, float>; /*!< Floating-point type used by relative() */
+
+  Time_() : cv::Mat_<Ts>(S::HEIGHT, S::WIDTH) {}
+
+  template <typename T, typename Tt>
+  inline double insert(const Event_<T, Tt> &e) {
+    return set(e.x, e.y, static_cast<double>(e.t));
   }
 
   template <typename T>
@@ -76,31 +265,380 @@ public:
   }
 
   inline void clear() {
-    cv::Mat_<double>::setTo(0);
+    if(tiles_) {
+      tiles_->fill(*this, Ts{0});
+      tiles_->clear();
+    } else {
+      S::template fill<Ts>(*this, Ts{0});
+    }
+    base_ = 0;
+    based_ = false;
+  }
+
+  /*!
+  \brief Keep track of the written tiles, so that clear() only visits them.
+  \param tile Side of the tiles
+  \see Tiles_
+  */
+  inline void track(const int tile = 32) {
+    tiles_.emplace(this->rows, this->cols, tile);
+    tiles_->mark();
+  }
+
+  /*!
+  \brief Tiles written since the last clear().
+  \return Tiles, or nullptr if they are not tracked
+  */
+  [[nodiscard]] inline const Tiles_<S> *tiles() const { return tiles_ ? &*tiles_ : nullptr; }
+
+  /*!
+  \brief Timestamp of a pixel.
+  \param x Spatial coordinate x
+  \param y Spatial coordinate y
+  \return Absolute timestamp, or zero if no event has been inserted in the pixel
+  */
+  [[nodiscard]] inline double timestamp(const int x, const int y) const {
+    const Ts v = this->template ptr<Ts>(y)[x];
+    if constexpr(RELATIVE) {
+      return v == Ts{0} ? 0.0 : base_ + static_cast<double>(v) * tick_;
+    } else {
+      return v;
+    }
+  }
+
+  /*!
+  \brief Set the resolution of relative timestamps. The matrix is cleared.
+  \param tick Duration of one tick in the units of the timestamps (e.g., 1e-6 if timestamps are in seconds and the sensor has microsecond resolution)
+  \note It has no effect if timestamps are absolute.
+  */
+  inline void setTick(const double tick) {
+    tick_ = tick;
+    clear();
+  }
+
+  /*!
+  \brief Resolution of relative timestamps.
+  \return Duration of one tick in the units of the timestamps
+  */
+  [[nodiscard]] inline double tick() const { return tick_; }
+
+  /*!
+  \brief Base of the relative timestamps.
+  \return Base (always zero if timestamps are absolute)
+  */
+  [[nodiscard]] inline double base() const { return base_; }
+
+  /*!
+  \brief Compute the timestamps relative to a reference time, i.e., timestamp(x, y) - t.
+  \param t Reference time
+  \param dst Output matrix. Pixels without events are set to minus infinity.
+  \note The subtraction is done in RenderType and in ticks, i.e., in single precision if the storage is relative.
+  */
+  inline void relative(const double t, cv::Mat_<RenderType> &dst) const {
+    dst.create(this->rows, this->cols);
+    const RenderType ref = static_cast<RenderType>((t - base_) / tick_);
+    const RenderType tick = static_cast<RenderType>(tick_);
+    for(int y = 0; y < this->rows; y++) {
+      const Ts *src = this->template ptr<Ts>(y);
+      RenderType *out = dst.template ptr<RenderType>(y);
+      for(int x = 0; x < this->cols; x++) {
+        out[x] = src[x] == Ts{0} ? -std::numeric_limits<RenderType>::infinity() : (static_cast<RenderType>(src[x]) - ref) * tick;
+      }
+    }
   }
 
-  friend std::ostream &operator<<(std::ostream &os, const Time &time) {
+  friend std::ostream &operator<<(std::ostream &os, const Time_ &time) {
     os << "Time " << time.cols << "x" << time.rows;
     return os;
   }
 
 private:
+  static constexpr double LIMIT = std::is_same_v<Ts, float> ? 16777216.0 : 2147483647.0;
+
+  double base_{0};
+  double tick_{1};
+  bool based_{false};
+  std::optional<Tiles_<S>> tiles_;
+
   template <typename T>
   inline double set(const T x, const T y, const double t) {
-    if constexpr(std::is_floating_point_v<T>) {
-      return *(this->ptr<double>(std::lround(y)) + std::lround(x)) = t;
+    return store(S::pixel(x), S::pixel(y), t);
+  }
+
+  inline double store(const int x, const int y, const double t) {
+    if(tiles_) {
+      tiles_->mark(x, y);
+    }
+    if constexpr(RELATIVE) {
+      if(!based_) {
+        base_ = t - tick_;
+        based_ = true;
+      }
+      if((t - base_) / tick_ >= LIMIT) {
+        rebase(std::floor((t - base_) / tick_ - LIMIT / 2));
+      }
+      const double d = std::max((t - base_) / tick_, 1.0);
+      if constexpr(std::is_integral_v<Ts>) {
+        S::at(*this, x, y) = static_cast<Ts>(std::lround(d));
+      } else {
+        S::at(*this, x, y) = static_cast<Ts>(d);
+      }
+      return t;
+    } else {
+      return S::at(*this, x, y) = t;
+    }
+  }
+
+  inline void rebase(const double shift) {
+    const Ts s = static_cast<Ts>(shift);
+    for(int y = 0; y < this->rows; y++) {
+      Ts *row = this->template ptr<Ts>(y);
+      for(int x = 0; x < this->cols; x++) {
+        if(row[x] != Ts{0}) {
+          row[x] = row[x] > s ? static_cast<Ts>(row[x] - s) : Ts{1};
+        }
+      }
+    }
+    base_ += shift * tick_;
+  }
+};
+using Time = Time_<>;
+using Timef = Time_<Sensor<>, float>;
+using Timei = Time_<Sensor<>, int32_t>;
+
+/*!
+\brief This class implements a multi-slot surface of active events, i.e., the last K timestamps and polarities of each pixel.
+
+Each pixel owns a ring of K slots stored contiguously (timestamps, then a polarity bit mask, the position of the newest slot, and the number of valid slots), so that a query on a pixel reads a single cache line for small K. Insertion is O(1): it overwrites the oldest slot. Empty slots hold the lowest representable timestamp, so that counting queries are branchless loops over the K slots.
+
+Timestamps are stored as absolute values, hence only double storage is allowed: a float slot would quantize microsecond timestamps above 2^24 (about 16.7 seconds).
+\code{.cpp}
+ev::Mat::TimeRing<4> ring(720, 1280);
+ring.insert(e);
+const int recent = ring.count(e.x, e.y, e.t, 1000); // events of the pixel within the last 1000 time units
+const double isi = ring.meanInterval(e.x, e.y);      // mean inter-spike interval
+\endcode
+*/
+template <std::size_t K, typename S = Sensor<>, typename Ts = double>
+class TimeRing_ {
+  static_assert(K >= 1 && K <= 32, "TimeRing_: number of slots must be between 1 and 32");
+  static_assert(std::is_same_v<Ts, double>, "TimeRing_: timestamps are absolute and must be stored as double; use Time_ for relative float storage");
+
+public:
+  static constexpr Ts EMPTY = std::numeric_limits<Ts>::lowest(); /*!< Timestamp of empty slots */
+
+  TimeRing_() : TimeRing_(S::HEIGHT, S::WIDTH) {}
+
+  TimeRing_(const int nrows, const int ncols) : rows{std::max(nrows, 0)}, cols{std::max(ncols, 0)}, slots_(static_cast<std::size_t>(rows) * cols) {
+    clear();
+  }
+
+  explicit TimeRing_(const cv::Size &size) : TimeRing_(size.height, size.width) {}
+
+  int rows; /*!< Number of rows */
+  int cols; /*!< Number of columns */
+
+  [[nodiscard]] inline cv::Size size() const { return {cols, rows}; }
+
+  template <typename T, typename Tt>
+  inline void insert(const Event_<T, Tt> &e) {
+    set(e.x, e.y, static_cast<Ts>(e.t), e.p);
+  }
+
+  template <typename T>
+  inline void emplace(const T x, const T y, const double t, const bool p) {
+    set(x, y, static_cast<Ts>(t), p);
+  }
+
+  inline void clear() {
+    Slot empty;
+    empty.t.fill(EMPTY);
+    std::fill(slots_.begin(), slots_.end(), empty);
+  }
+
+  /*!
+  \brief Number of valid slots of a pixel.
+  \param x Spatial coordinate x
+  \param y Spatial coordinate y
+  \return Number of events stored, up to K
+  */
+  [[nodiscard]] inline std::size_t size(const int x, const int y) const {
+    return slot(x, y).size;
+  }
+
+  /*!
+  \brief Timestamp of a pixel.
+  \param x Spatial coordinate x
+  \param y Spatial coordinate y
+  \param i Age of the event (0 is the newest)
+  \return Timestamp, or EMPTY if the pixel has less than i + 1 events
+  */
+  [[nodiscard]] inline Ts timestamp(const int x, const int y, const std::size_t i = 0) const {
+    const Slot &s = slot(x, y);
+    return i < s.size ? s.t[position(s, i)] : EMPTY;
+  }
+
+  /*!
+  \brief Polarity of a pixel.
+  \param x Spatial coordinate x
+  \param y Spatial coordinate y
+  \param i Age of the event (0 is the newest)
+  \return Polarity, or false if the pixel has less than i + 1 events
+  */
+  [[nodiscard]] inline bool polarity(const int x, const int y, const std::size_t i = 0) const {
+    const Slot &s = slot(x, y);
+    return i < s.size && ((s.p >> position(s, i)) & 1U);
+  }
+
+  /*!
+  \brief Number of events of a pixel within a time window, i.e., with timestamp in [t - dt, t].
+  \param x Spatial coordinate x
+  \param y Spatial coordinate y
+  \param t Reference time
+  \param dt Length of the window
+  \return Number of events, up to K
+  */
+  [[nodiscard]] inline int count(const int x, const int y, const double t, const double dt) const {
+    return within(slot(x, y), static_cast<Ts>(t - dt), static_cast<Ts>(t));
+  }
+
+  /*!
+  \brief Number of events of a pixel with a given polarity within a time window.
+  \param x Spatial coordinate x
+  \param y Spatial coordinate y
+  \param t Reference time
+  \param dt Length of the window
+  \param p Polarity
+  \return Number of events, up to K
+  */
+  [[nodiscard]] inline int count(const int x, const int y, const double t, const double dt, const bool p) const {
+    const Slot &s = slot(x, y);
+    const Ts from = static_cast<Ts>(t - dt);
+    const Ts to = static_cast<Ts>(t);
+    const uint32_t mask = p ? s.p : ~s.p;
+    int n = 0;
+    for(std::size_t k = 0; k < K; k++) {
+      n += static_cast<int>((s.t[k] >= from) & (s.t[k] <= to) & static_cast<bool>((mask >> k) & 1U));
+    }
+    return n;
+  }
+
+  /*!
+  \brief Number of events of each pixel within a time window.
+  \param t Reference time
+  \param dt Length of the window
+  \param dst Output matrix
+  */
+  inline void count(const double t, const double dt, cv::Mat_<int> &dst) const {
+    dst.create(rows, cols);
+    const Ts from = static_cast<Ts>(t - dt);
+    const Ts to = static_cast<Ts>(t);
+    for(int y = 0; y < rows; y++) {
+      const Slot *row = slots_.data() + static_cast<std::size_t>(y) * cols;
+      int *out = dst.template ptr<int>(y);
+      for(int x = 0; x < cols; x++) {
+        out[x] = within(row[x], from, to);
+      }
+    }
+  }
+
+  /*!
+  \brief Mean interval between the events of a pixel.
+  \param x Spatial coordinate x
+  \param y Spatial coordinate y
+  \return Mean interval, or zero if the pixel has less than two events
+  */
+  [[nodiscard]] inline double meanInterval(const int x, const int y) const {
+    return interval(slot(x, y));
+  }
+
+  /*!
+  \brief Mean interval between the events of each pixel.
+  \param dst Output matrix. Pixels with less than two events are set to zero.
+  */
+  inline void meanInterval(cv::Mat_<float> &dst) const {
+    dst.create(rows, cols);
+    for(int y = 0; y < rows; y++) {
+      const Slot *row = slots_.data() + static_cast<std::size_t>(y) * cols;
+      float *out = dst.template ptr<float>(y);
+      for(int x = 0; x < cols; x++) {
+        out[x] = static_cast<float>(interval(row[x]));
+      }
+    }
+  }
+
+  friend std::ostream &operator<<(std::ostream &os, const TimeRing_ &ring) {
+    os << "TimeRing<" << K << "> " << ring.cols << "x" << ring.rows;
+    return os;
+  }
+
+private:
+  struct Slot {
+    std::array<Ts, K> t;
+    uint32_t p{0};
+    uint8_t head{0};
+    uint8_t size{0};
+  };
+
+  std::vector<Slot> slots_;
+
+  [[nodiscard]] inline const Slot &slot(const int x, const int y) const {
+    return slots_[index(x, y)];
+  }
+
+  [[nodiscard]] inline std::size_t index(const int x, const int y) const {
+    if constexpr(S::FIXED) {
+      return static_cast<std::size_t>(y) * S::WIDTH + x;
     } else {
-      return *(this->ptr<double>(y) + x) = t;
+      return static_cast<std::size_t>(y) * cols + x;
+    }
+  }
+
+  [[nodiscard]] static inline std::size_t position(const Slot &s, const std::size_t i) {
+    return (s.head + K - i) % K;
+  }
+
+  [[nodiscard]] static inline int within(const Slot &s, const Ts from, const Ts to) {
+    int n = 0;
+    for(std::size_t k = 0; k < K; k++) {
+      n += static_cast<int>((s.t[k] >= from) & (s.t[k] <= to));
+    }
+    return n;
+  }
+
+  [[nodiscard]] static inline double interval(const Slot &s) {
+    if(s.size < 2) {
+      return 0;
+    }
+    return static_cast<double>(s.t[s.head] - s.t[position(s, s.size - 1)]) / (s.size - 1);
+  }
+
+  template <typename T>
+  inline void set(const T x, const T y, const Ts t, const bool p) {
+    store(slots_[index(S::pixel(x), S::pixel(y))], t, p);
+  }
+
+  static inline void store(Slot &s, const Ts t, const bool p) {
+    if(s.size) {
+      s.head = static_cast<uint8_t>(s.head + 1 == K ? 0 : s.head + 1);
     }
+    s.size = static_cast<uint8_t>(s.size + (s.size < K));
+    s.t[s.head] = t;
+    s.p = (s.p & ~(uint32_t{1} << s.head)) | (static_cast<uint32_t>(p) << s.head);
   }
 };
+template <std::size_t K>
+using TimeRing = TimeRing_<K>;
 
-class Polarity : public cv::Mat_<bool> {
+template <typename S = Sensor<>>
+class Polarity_ : public cv::Mat_<bool> {
 public:
   using cv::Mat_<bool>::Mat_;
 
-  template <typename T>
-  inline bool insert(const Event_<T> &e) {
+  Polarity_() : cv::Mat_<bool>(S::HEIGHT, S::WIDTH) {}
+
+  template <typename T, typename Tt>
+  inline bool insert(const Event_<T, Tt> &e) {
     return set(e.x, e.y, e.p);
   }
 
@@ -110,10 +648,10 @@ public:
   }
 
   inline void clear() {
-    cv::Mat_<bool>::setTo(0);
+    S::template fill<bool>(*this, false);
   }
 
-  friend std::ostream &operator<<(std::ostream &os, const Polarity &polarity) {
+  friend std::ostream &operator<<(std::ostream &os, const Polarity_ &polarity) {
     os << "Polarity " << polarity.cols << "x" << polarity.rows;
     return os;
   }
@@ -121,33 +659,120 @@ public:
 private:
   template <typename T>
   inline bool set(const T x, const T y, const bool p) {
-    if constexpr(std::is_floating_point_v<T>) {
-      return *(this->ptr<bool>(std::lround(y)) + std::lround(x)) = p;
-    } else {
-      return *(this->ptr<bool>(y) + x) = p;
-    }
+    return S::at(*this, S::pixel(x), S::pixel(y)) = p;
   }
 };
+using Polarity = Polarity_<>;
+
+/*!
+\brief This class implements a matrix of event counts, where ON events add one and OFF events subtract one.
 
-class Counter : public cv::Mat_<int> {
+Events can be inserted one by one or in bulk. Bulk insertion splits the events across threads, each of which counts into a private matrix, and then adds the private matrices together row by row:
+\code{.cpp}
+ev::Mat::Counter counter(720, 1280);
+counter.clear();
+counter.insert(batch); // e.g., ev::EventBatch or ev::Vector
+\endcode
+*/
+template <typename S = Sensor<>>
+class Counter_ : public cv::Mat_<int> {
 public:
   using cv::Mat_<int>::Mat_;
 
-  template <typename T>
-  inline int insert(const Event_<T> &e) {
+  static constexpr std::size_t MIN_EVENTS_PER_THREAD = ev::MIN_EVENTS_PER_THREAD; /*!< Minimum number of events per thread in bulk insertion */
+
+  Counter_() : cv::Mat_<int>(S::HEIGHT, S::WIDTH) {}
+
+  template <typename T, typename Tt>
+  inline int insert(const Event_<T, Tt> &e) {
     return set(e.x, e.y, e.p);
   }
 
+  /*!
+  \brief Undo the insertion of an event, e.g., when it falls out of a sliding window (see TimeWindow_).
+  \param e Event, which must have been inserted before
+  \return Count of the pixel after the removal
+  */
+  template <typename T, typename Tt>
+  inline int remove(const Event_<T, Tt> &e) {
+    return set(e.x, e.y, !e.p);
+  }
+
+  /*!
+  \brief Insert events in bulk.
+  \param events Container of events (e.g., Vector_) or with coordinate and polarity columns (e.g., EventBatch_)
+  \param threads Number of threads. By default, the number of threads used by OpenCV.
+  \note Events are not bound-checked. Windows smaller than MIN_EVENTS_PER_THREAD events per thread use fewer threads. The per-thread partial counters are kept between calls, so repeated insertions do not allocate. If tiles are tracked, all tiles are marked as dirty.
+  */
+  template <typename Container, typename = std::void_t<decltype(std::declval<const Container &>().size())>>
+  inline void insert(const Container &events, const int threads = 0) {
+    const std::size_t n = events.size();
+    const int workers = static_cast<int>(std::min<std::size_t>(threads > 0 ? threads : cv::getNumThreads(), n / MIN_EVENTS_PER_THREAD));
+    if(tiles_) {
+      tiles_->mark();
+    }
+    if(workers <= 1) {
+      scatter(*this, events, 0, n);
+      return;
+    }
+
+    if(partials_.size() < static_cast<std::size_t>(workers - 1)) {
+      partials_.resize(workers - 1);
+    }
+    const auto work = [&](const cv::Range &range) {
+      for(int k = range.start; k < range.end; k++) {
+        cv::Mat_<int> &dst = k == 0 ? *this : partials_[k - 1];
+        if(k > 0) {
+          dst.create(rows, cols);
+          for(int y = 0; y < rows; y++) {
+            std::fill_n(dst.template ptr<int>(y), cols, 0);
+          }
+        }
+        scatter(dst, events, n * k / workers, n * (k + 1) / workers);
+      }
+    };
+    cv::parallel_for_(cv::Range(0, workers), work, workers);
+
+    cv::parallel_for_(cv::Range(0, rows), [&](const cv::Range &range) {
+      for(int y = range.start; y < range.end; y++) {
+        for(int k = 0; k < workers - 1; k++) {
+          simd::add(ptr<int>(y), partials_[k].ptr<int>(y), static_cast<std::size_t>(cols));
+        }
+      }
+    });
+  }
+
   template <typename T>
   inline int emplace(const T x, const T y, const bool p) {
     return set(x, y, p);
   }
 
   inline void clear() {
-    cv::Mat_<int>::setTo(0);
+    if(tiles_) {
+      tiles_->fill(*this, 0);
+      tiles_->clear();
+    } else {
+      S::template fill<int>(*this, 0);
+    }
+  }
+
+  /*!
+  \brief Keep track of the written tiles, so that clear() only visits them.
+  \param tile Side of the tiles
+  \see Tiles_
+  */
+  inline void track(const int tile = 32) {
+    tiles_.emplace(this->rows, this->cols, tile);
+    tiles_->mark();
   }
 
-  friend std::ostream &operator<<(std::ostream &os, const Counter &counter) {
+  /*!
+  \brief Tiles written since the last clear().
+  \return Tiles, or nullptr if they are not tracked
+  */
+  [[nodiscard]] inline const Tiles_<S> *tiles() const { return tiles_ ? &*tiles_ : nullptr; }
+
+  friend std::ostream &operator<<(std::ostream &os, const Counter_ &counter) {
     os << "Counter " << counter.cols << "x" << counter.rows;
     return os;
   }
@@ -155,13 +780,441 @@ public:
 private:
   template <typename T>
   inline int set(const T x, const T y, const bool p) {
-    if constexpr(std::is_floating_point_v<T>) {
-      return *(this->ptr<int>(std::lround(y)) + std::lround(x)) += (p ? +1 : -1);
+    return add(S::pixel(x), S::pixel(y), p);
+  }
+
+  inline int add(const int x, const int y, const bool p) {
+    if(tiles_) {
+      tiles_->mark(x, y);
+    }
+    return S::at(*this, x, y) += (p ? +1 : -1);
+  }
+
+  template <typename Container>
+  static inline void scatter(cv::Mat_<int> &dst, const Container &events, const std::size_t begin, const std::size_t end) {
+    if constexpr(HasColumns<Container>::value) {
+      const auto *x = events.x().data();
+      const auto *y = events.y().data();
+      const auto *p = events.p().data();
+      for(std::size_t i = begin; i < end; i++) {
+        S::at(dst, S::pixel(x[i]), S::pixel(y[i])) += (p[i] ? +1 : -1);
+      }
+    } else {
+      for(std::size_t i = begin; i < end; i++) {
+        const auto &e = events[i];
+        S::at(dst, S::pixel(e.x), S::pixel(e.y)) += (e.p ? +1 : -1);
+      }
+    }
+  }
+
+  std::optional<Tiles_<S>> tiles_;
+  std::vector<cv::Mat_<int>> partials_;
+};
+using Counter = Counter_<>;
+
+/*!
+\brief This class implements a two-channel event counter with separate ON and OFF counts.
+
+Unlike Counter_, ON and OFF events do not cancel out. Counts are stored interleaved (channel ON first, then OFF) with an unsigned type of 8 or 16 bits, and they saturate at the maximum value of that type, so that the matrix can be fed directly to a network as a two-channel input:
+\code{.cpp}
+ev::Mat::PolarityCounterw counter(720, 1280); // cv::Mat_<cv::Vec2w>, 3.7 MB
+\endcode
+*/
+template <typename S = Sensor<>, typename Tc = uint8_t>
+class PolarityCounter_ : public cv::Mat_<cv::Vec<Tc, 2>> {
+  static_assert(std::is_same_v<Tc, uint8_t> || std::is_same_v<Tc, uint16_t>, "PolarityCounter_: storage must be uint8_t or uint16_t");
+
+public:
+  using cv::Mat_<cv::Vec<Tc, 2>>::Mat_;
+
+  static constexpr int ON = 0;  /*!< Channel of ON events */
+  static constexpr int OFF = 1; /*!< Channel of OFF events */
+
+  PolarityCounter_() : cv::Mat_<cv::Vec<Tc, 2>>(S::HEIGHT, S::WIDTH) {}
+
+  /*!
+  \brief Insert an event.
+  \param e Event
+  \return Difference between the ON and OFF counts of the pixel
+  */
+  template <typename T, typename Tt>
+  inline int insert(const Event_<T, Tt> &e) {
+    return set(e.x, e.y, e.p);
+  }
+
+  template <typename T>
+  inline int emplace(const T x, const T y, const bool p) {
+    return set(x, y, p);
+  }
+
+  inline void clear() {
+    if(tiles_) {
+      tiles_->fill(*this, cv::Vec<Tc, 2>());
+      tiles_->clear();
+    } else {
+      S::template fill<cv::Vec<Tc, 2>>(*this, cv::Vec<Tc, 2>());
+    }
+  }
+
+  /*!
+  \brief Difference between the ON and OFF counts of a pixel.
+  \param x Spatial coordinate x
+  \param y Spatial coordinate y
+  \return Difference
+  */
+  [[nodiscard]] inline int net(const int x, const int y) const {
+    const cv::Vec<Tc, 2> &v = this->template ptr<cv::Vec<Tc, 2>>(y)[x];
+    return static_cast<int>(v[ON]) - static_cast<int>(v[OFF]);
+  }
+
+  /*!
+  \brief Keep track of the written tiles, so that clear() only visits them.
+  \param tile Side of the tiles
+  \see Tiles_
+  */
+  inline void track(const int tile = 32) {
+    tiles_.emplace(this->rows, this->cols, tile);
+    tiles_->mark();
+  }
+
+  /*!
+  \brief Tiles written since the last clear().
+  \return Tiles, or nullptr if they are not tracked
+  */
+  [[nodiscard]] inline const Tiles_<S> *tiles() const { return tiles_ ? &*tiles_ : nullptr; }
+
+  friend std::ostream &operator<<(std::ostream &os, const PolarityCounter_ &counter) {
+    os << "PolarityCounter " << counter.cols << "x" << counter.rows;
+    return os;
+  }
+
+private:
+  std::optional<Tiles_<S>> tiles_;
+
+  template <typename T>
+  inline int set(const T x, const T y, const bool p) {
+    return add(S::pixel(x), S::pixel(y), p);
+  }
+
+  inline int add(const int x, const int y, const bool p) {
+    if(tiles_) {
+      tiles_->mark(x, y);
+    }
+    cv::Vec<Tc, 2> &v = S::at(*this, x, y);
+    Tc &c = v[p ? ON : OFF];
+    c += static_cast<Tc>(c != std::numeric_limits<Tc>::max());
+    return static_cast<int>(v[ON]) - static_cast<int>(v[OFF]);
+  }
+};
+using PolarityCounter = PolarityCounter_<>;
+using PolarityCounterb = PolarityCounter_<Sensor<>, uint8_t>;
+using PolarityCounterw = PolarityCounter_<Sensor<>, uint16_t>;
+
+/*!
+\brief This class implements a bit-packed plane, i.e., a binary matrix with one bit per pixel.
+
+Bits are stored in 64-bit words in row-major order, so that clear(), count(), and the logical operators process 64 pixels per operation, and expansion to a cv::Mat mask writes 8 pixels per table lookup.
+*/
+template <typename S = Sensor<>>
+class BitPlane_ {
+public:
+  BitPlane_() : BitPlane_(S::HEIGHT, S::WIDTH) {}
+
+  BitPlane_(const int nrows, const int ncols) : rows{std::max(nrows, 0)}, cols{std::max(ncols, 0)}, words_((static_cast<std::size_t>(rows) * cols + 63) / 64, 0) {}
+
+  explicit BitPlane_(const cv::Size &size) : BitPlane_(size.height, size.width) {}
+
+  int rows; /*!< Number of rows */
+  int cols; /*!< Number of columns */
+
+  [[nodiscard]] inline cv::Size size() const { return {cols, rows}; }
+
+  [[nodiscard]] inline bool empty() const { return words_.empty(); }
+
+  [[nodiscard]] inline bool get(const int x, const int y) const {
+    const std::size_t i = index(x, y);
+    return static_cast<bool>((words_[i >> 6] >> (i & 63U)) & 1U);
+  }
+
+  /*!
+  \brief Read a bit with the argument order of cv::Mat_::operator(), so that reads written for Binary_ or Polarity_ keep compiling.
+  \param row Row (y)
+  \param col Column (x)
+  \return Bit
+  */
+  [[nodiscard]] inline bool operator()(const int row, const int col) const {
+    return get(col, row);
+  }
+
+  inline bool set(const int x, const int y, const bool value) {
+    const std::size_t i = index(x, y);
+    const uint64_t bit = uint64_t{1} << (i & 63U);
+    words_[i >> 6] = value ? (words_[i >> 6] | bit) : (words_[i >> 6] & ~bit);
+    return value;
+  }
+
+  inline void clear() {
+    std::fill(words_.begin(), words_.end(), uint64_t{0});
+  }
+
+  /*!
+  \brief Number of bits set.
+  \return Count
+  */
+  [[nodiscard]] inline std::size_t count() const {
+    std::size_t n = 0;
+    for(const uint64_t w : words_) {
+      n += std::bitset<64>(w).count();
+    }
+    return n;
+  }
+
+  /*!
+  \brief Copy the bits of another plane where a mask is set, i.e., this = (this & ~mask) | (other & mask).
+  \param other Plane with the same size
+  \param mask Plane with the same size
+  */
+  inline void merge(const BitPlane_ &other, const BitPlane_ &mask) {
+    for(std::size_t i = 0; i < words_.size(); i++) {
+      words_[i] = (words_[i] & ~mask.words_[i]) | (other.words_[i] & mask.words_[i]);
+    }
+  }
+
+  inline BitPlane_ &operator|=(const BitPlane_ &other) {
+    for(std::size_t i = 0; i < words_.size(); i++) {
+      words_[i] |= other.words_[i];
+    }
+    return *this;
+  }
+
+  inline BitPlane_ &operator&=(const BitPlane_ &other) {
+    for(std::size_t i = 0; i < words_.size(); i++) {
+      words_[i] &= other.words_[i];
+    }
+    return *this;
+  }
+
+  /*!
+  \brief Expand the plane into a mask.
+  \param dst Mask with 255 where the bit is equal to value, and 0 elsewhere
+  \param value Value of the bits to select
+  */
+  inline void toMask(cv::Mat_<uchar> &dst, const bool value = true) const {
+    dst.create(rows, cols);
+    uchar *out = dst.template ptr<uchar>(0);
+    const std::size_t n = static_cast<std::size_t>(rows) * cols;
+    const uint64_t flip = value ? uint64_t{0} : ~uint64_t{0};
+    for(std::size_t i = 0; i < words_.size(); i++) {
+      const uint64_t w = words_[i] ^ flip;
+      const std::size_t bytes = std::min<std::size_t>(64, n - 64 * i);
+      if(bytes == 64) {
+        for(std::size_t b = 0; b < 8; b++) {
+          const uint64_t expanded = EXPAND[(w >> (8 * b)) & 0xFFU];
+          std::memcpy(out + 64 * i + 8 * b, &expanded, 8);
+        }
+      } else {
+        for(std::size_t k = 0; k < bytes; k++) {
+          out[64 * i + k] = ((w >> k) & 1U) ? 255 : 0;
+        }
+      }
+    }
+  }
+
+  /*! \cond INTERNAL */
+  [[nodiscard]] inline const uint64_t *data() const { return words_.data(); }
+  /*! \endcond */
+
+protected:
+  std::vector<uint64_t> words_;
+
+  [[nodiscard]] inline std::size_t index(const int x, const int y) const {
+    if constexpr(S::FIXED) {
+      return static_cast<std::size_t>(y) * S::WIDTH + x;
+    } else {
+      return static_cast<std::size_t>(y) * cols + x;
+    }
+  }
+
+private:
+  static constexpr std::array<uint64_t, 256> EXPAND = []() {
+    std::array<uint64_t, 256> table{};
+    for(std::size_t v = 0; v < 256; v++) {
+      for(std::size_t b = 0; b < 8; b++) {
+        if((v >> b) & 1U) {
+          table[v] |= uint64_t{0xFF} << (8 * b);
+        }
+      }
+    }
+    return table;
+  }();
+};
+
+template <typename S = Sensor<>>
+class PackedBinary_ : public BitPlane_<S> {
+public:
+  using BitPlane_<S>::BitPlane_;
+
+  template <typename T, typename Tt>
+  inline bool insert(const Event_<T, Tt> &e) {
+    return emplace(e.x, e.y);
+  }
+
+  template <typename T>
+  inline bool emplace(const T x, const T y) {
+    return this->set(S::pixel(x), S::pixel(y), true);
+  }
+
+  friend std::ostream &operator<<(std::ostream &os, const PackedBinary_ &binary) {
+    os << "Binary " << binary.cols << "x" << binary.rows;
+    return os;
+  }
+};
+using PackedBinary = PackedBinary_<>;
+
+template <typename S = Sensor<>>
+class PackedPolarity_ : public BitPlane_<S> {
+public:
+  using BitPlane_<S>::BitPlane_;
+
+  template <typename T, typename Tt>
+  inline bool insert(const Event_<T, Tt> &e) {
+    return emplace(e.x, e.y, e.p);
+  }
+
+  template <typename T>
+  inline bool emplace(const T x, const T y, const bool p) {
+    return this->set(S::pixel(x), S::pixel(y), p);
+  }
+
+  /*!
+  \brief Expand the plane into a byte-per-pixel polarity matrix, e.g., for code written against Polarity_.
+  \return Polarity matrix
+  */
+  [[nodiscard]] inline Polarity_<S> unpack() const {
+    Polarity_<S> polarity(this->rows, this->cols);
+    for(int y = 0; y < this->rows; y++) {
+      bool *row = polarity.template ptr<bool>(y);
+      for(int x = 0; x < this->cols; x++) {
+        row[x] = this->get(x, y);
+      }
+    }
+    return polarity;
+  }
+
+  friend std::ostream &operator<<(std::ostream &os, const PackedPolarity_ &polarity) {
+    os << "Polarity " << polarity.cols << "x" << polarity.rows;
+    return os;
+  }
+};
+using PackedPolarity = PackedPolarity_<>;
+
+/*!
+\brief This class implements per-pixel generation stamps for O(1) clearing.
+
+Each pixel stores the epoch in which it was last written. clear() only increments the current epoch, so that every pixel becomes stale at once, regardless of the sensor resolution. Writers call touch() before writing a pixel and reset it if it was stale. Readers treat stale pixels as reset, or call resolve() to write the reset value into stale pixels before reading a whole matrix.
+
+Epochs are stored with the unsigned type Tg. When the epoch wraps around, clear() zeroes all the stamps once, so a narrow type trades memory for more frequent full clears.
+*/
+template <typename S = Sensor<>, typename Tg = uint32_t>
+class Epoch_ {
+  static_assert(std::is_unsigned_v<Tg>, "Epoch_: stamps must be unsigned");
+
+public:
+  Epoch_() : Epoch_(S::HEIGHT, S::WIDTH) {}
+
+  Epoch_(const int nrows, const int ncols) : rows{std::max(nrows, 0)}, cols{std::max(ncols, 0)}, stamps_(static_cast<std::size_t>(rows) * cols, Tg{0}) {}
+
+  explicit Epoch_(const cv::Size &size) : Epoch_(size.height, size.width) {}
+
+  int rows; /*!< Number of rows */
+  int cols; /*!< Number of columns */
+
+  [[nodiscard]] inline cv::Size size() const { return {cols, rows}; }
+
+  /*!
+  \brief Make all pixels stale in O(1).
+  */
+  inline void clear() {
+    if(++epoch_ == 0) {
+      std::fill(stamps_.begin(), stamps_.end(), Tg{0});
+      epoch_ = 1;
+    }
+  }
+
+  /*!
+  \brief Mark a pixel as written in the current epoch.
+  \param x Spatial coordinate x
+  \param y Spatial coordinate y
+  \return True if the pixel was stale, i.e., it must be reset before writing
+  */
+  inline bool touch(const int x, const int y) {
+    Tg &stamp = stamps_[index(x, y)];
+    if(stamp != epoch_) {
+      stamp = epoch_;
+      return true;
+    }
+    return false;
+  }
+
+  /*!
+  \brief Mark all pixels as written in the current epoch.
+  */
+  inline void touch() {
+    std::fill(stamps_.begin(), stamps_.end(), epoch_);
+  }
+
+  /*!
+  \brief Check if a pixel has been written in the current epoch.
+  \param x Spatial coordinate x
+  \param y Spatial coordinate y
+  \return True if the pixel is not stale
+  */
+  [[nodiscard]] inline bool fresh(const int x, const int y) const {
+    return stamps_[index(x, y)] == epoch_;
+  }
+
+  /*!
+  \brief Write a value into the stale pixels of a matrix.
+  \param m Matrix with the same size
+  \param value Reset value
+  */
+  template <typename Tp>
+  inline void resolve(cv::Mat_<Tp> &m, const Tp &value) const {
+    resolve(m, value, cv::Rect(0, 0, cols, rows));
+  }
+
+  /*!
+  \brief Write a value into the stale pixels of a region of a matrix.
+  \param m Matrix with the same size
+  \param value Reset value
+  \param roi Region
+  */
+  template <typename Tp>
+  inline void resolve(cv::Mat_<Tp> &m, const Tp &value, const cv::Rect &roi) const {
+    for(int y = roi.y; y < roi.y + roi.height; y++) {
+      Tp *row = m.template ptr<Tp>(y);
+      const Tg *stamps = stamps_.data() + static_cast<std::size_t>(y) * cols;
+      for(int x = roi.x; x < roi.x + roi.width; x++) {
+        if(stamps[x] != epoch_) {
+          row[x] = value;
+        }
+      }
+    }
+  }
+
+private:
+  std::vector<Tg> stamps_;
+  Tg epoch_{1};
+
+  [[nodiscard]] inline std::size_t index(const int x, const int y) const {
+    if constexpr(S::FIXED) {
+      return static_cast<std::size_t>(y) * S::WIDTH + x;
     } else {
-      return *(this->ptr<int>(y) + x) += (p ? +1 : -1);
+      return static_cast<std::size_t>(y) * cols + x;
     }
   }
 };
+using Epoch = Epoch_<>;
 } // namespace Mat
 } // namespace ev
 
@@ -0,0 +1,146 @@
+/*!
+\file sensor.hpp
+\brief Compile-time sensor geometry.
+\author Raul Tapia
+*/
+#ifndef OPENEV_CORE_SENSOR_HPP
+#define OPENEV_CORE_SENSOR_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <opencv2/core/mat.hpp>
+#include <opencv2/core/types.hpp>
+#include <type_traits>
+
+namespace ev {
+/*!
+\brief This class defines the geometry of an event sensor.
+
+When the width and height are given as template parameters, the geometry is fixed at compile time: bound checks compare against constants, pixels are addressed with a constant stride, and loops over the whole sensor have a constant trip count. Matrices using a fixed geometry must be continuous and have exactly the size of the sensor.
+
+When the width and height are zero (default), the geometry is taken at runtime from the size of the matrices.
+
+The following aliases are defined for convenience:
+\code{.cpp}
+using DynamicSensor = Sensor<>;
+using SensorDavis240 = Sensor<240, 180>;
+using SensorDavis346 = Sensor<346, 260>;
+using SensorVGA = Sensor<640, 480>;
+\endcode
+
+\code{.cpp}
+ev::EventImage_<uchar, ev::RepresentationOptions::NONE, int, double, ev::SensorDavis346> image;
+ev::Mat::Time_<ev::SensorDavis346> time;
+\endcode
+*/
+template <int W = 0, int H = 0>
+struct Sensor {
+  static_assert(W >= 0 && H >= 0 && (W > 0) == (H > 0), "Sensor: width and height must be both positive or both zero");
+
+  static constexpr int WIDTH = W;                                      /*!< Sensor width (zero if dynamic) */
+  static constexpr int HEIGHT = H;                                     /*!< Sensor height (zero if dynamic) */
+  static constexpr bool FIXED = W > 0;                                 /*!< True if the geometry is known at compile time */
+  static constexpr std::size_t AREA = static_cast<std::size_t>(W) * H; /*!< Number of pixels (zero if dynamic) */
+
+  /*!
+  \brief Sensor size.
+  \return Size of the sensor (empty if dynamic)
+  */
+  [[nodiscard]] static inline cv::Size size() { return {W, H}; }
+
+  /*!
+  \brief Check if a pixel lies inside the sensor.
+  \param x Spatial coordinate x
+  \param y Spatial coordinate y
+  \param cols Number of columns of the matrix (only used if dynamic)
+  \param rows Number of rows of the matrix (only used if dynamic)
+  \return True if the pixel is inside
+  */
+  template <typename T>
+  [[nodiscard]] static inline bool contains(const T x, const T y, const int cols, const int rows) {
+    if constexpr(FIXED) {
+      return inside(x, y, W, H);
+    } else {
+      return inside(x, y, cols, rows);
+    }
+  }
+
+  /*!
+  \brief Pixel of a spatial coordinate.
+
+  Floating-point coordinates are rounded to the nearest pixel, integer coordinates are used as they are. Matrices and representations use this function, so that they all write the same pixel for an event.
+  \param v Spatial coordinate x or y
+  \return Pixel coordinate
+  */
+  template <typename T>
+  [[nodiscard]] static inline int pixel(const T v) {
+    if constexpr(std::is_floating_point_v<T>) {
+      return static_cast<int>(std::lround(v));
+    } else {
+      return static_cast<int>(v);
+    }
+  }
+
+  /*!
+  \brief Check if a matrix matches the sensor geometry.
+  \param m Matrix
+  \return True if the geometry is dynamic, or if the matrix is continuous and has the size of the sensor
+  */
+  template <typename Tp>
+  [[nodiscard]] static inline bool valid(const cv::Mat_<Tp> &m) {
+    if constexpr(FIXED) {
+      return m.cols == W && m.rows == H && m.isContinuous();
+    } else {
+      return true;
+    }
+  }
+
+  /*!
+  \brief Access a pixel of a matrix.
+  \param m Matrix
+  \param x Spatial coordinate x
+  \param y Spatial coordinate y
+  \return Reference to the pixel
+  */
+  template <typename Tp>
+  [[nodiscard]] static inline Tp &at(cv::Mat_<Tp> &m, const int x, const int y) {
+    if constexpr(FIXED) {
+      return reinterpret_cast<Tp *>(m.data)[static_cast<std::size_t>(y) * W + x];
+    } else {
+      return *(m.template ptr<Tp>(y) + x);
+    }
+  }
+
+  /*!
+  \brief Set all the pixels of a matrix to a value.
+  \param m Matrix
+  \param value Value
+  */
+  template <typename Tp>
+  static inline void fill(cv::Mat_<Tp> &m, const Tp &value) {
+    if constexpr(FIXED) {
+      std::fill_n(reinterpret_cast<Tp *>(m.data), AREA, value);
+    } else {
+      m.setTo(value);
+    }
+  }
+
+private:
+  template <typename T>
+  [[nodiscard]] static inline bool inside(const T x, const T y, const int cols, const int rows) {
+    if constexpr(std::is_integral_v<T>) {
+      using U = std::make_unsigned_t<std::common_type_t<T, int>>;
+      return static_cast<U>(x) < static_cast<U>(cols) && static_cast<U>(y) < static_cast<U>(rows);
+    } else {
+      return x >= 0 && y >= 0 && x < cols && y < rows;
+    }
+  }
+};
+using DynamicSensor = Sensor<>;          /*!< Alias for Sensor with runtime geometry */
+using SensorDavis240 = Sensor<240, 180>; /*!< Alias for Sensor with DAVIS240 geometry */
+using SensorDavis346 = Sensor<346, 260>; /*!< Alias for Sensor with DAVIS346 geometry */
+using SensorVGA = Sensor<640, 480>;      /*!< Alias for Sensor with VGA geometry */
+} // namespace ev
+
+#endif // OPENEV_CORE_SENSOR_HPP
@@ -0,0 +1,128 @@
+/*!
+\file simd.hpp
+\brief Vectorizable kernels over contiguous columns of event data.
+\author Raul Tapia
+*/
+#ifndef OPENEV_CORE_SIMD_HPP
+#define OPENEV_CORE_SIMD_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+
+namespace ev {
+namespace simd {
+/*!
+\brief Number of independent accumulators used by the kernels.
+
+Kernels split the input in blocks of LANES elements and keep one partial result per lane. Since every lane is updated in a fixed order, the compiler is allowed to map the lanes to vector registers without reassociating floating-point operations.
+*/
+constexpr std::size_t LANES = 8;
+
+/*!
+\brief Alignment (in bytes) used for column storage.
+*/
+constexpr std::size_t ALIGNMENT = 64;
+
+/*! \cond INTERNAL */
+template <typename T>
+using Accumulator = std::conditional_t<std::is_integral_v<T>, int64_t, double>;
+/*! \endcond */
+
+/*!
+\brief Sum of a contiguous column.
+\param data Pointer to the first element
+\param n Number of elements
+\return Sum of the elements. Integral columns are accumulated exactly using 64-bit integers.
+*/
+template <typename T>
+[[nodiscard]] inline double sum(const T *data, const std::size_t n) {
+  std::array<Accumulator<T>, LANES> acc{};
+  std::size_t i = 0;
+  for(; i + LANES <= n; i += LANES) {
+    for(std::size_t k = 0; k < LANES; k++) {
+      acc[k] += static_cast<Accumulator<T>>(data[i + k]);
+    }
+  }
+  for(std::size_t k = 0; i < n; i++, k++) {
+    acc[k] += static_cast<Accumulator<T>>(data[i]);
+  }
+  return static_cast<double>(std::accumulate(acc.begin(), acc.end(), Accumulator<T>{0}));
+}
+
+/*!
+\brief Sum of a contiguous column relative to a reference value.
+\param data Pointer to the first element
+\param n Number of elements
+\param ref Reference value subtracted from each element
+\return Sum of the differences
+\note This is useful to accumulate large values (e.g., timestamps) without losing precision.
+*/
+template <typename T>
+[[nodiscard]] inline double sum(const T *data, const std::size_t n, const T ref) {
+  std::array<Accumulator<T>, LANES> acc{};
+  std::size_t i = 0;
+  for(; i + LANES <= n; i += LANES) {
+    for(std::size_t k = 0; k < LANES; k++) {
+      acc[k] += static_cast<Accumulator<T>>(data[i + k]) - static_cast<Accumulator<T>>(ref);
+    }
+  }
+  for(std::size_t k = 0; i < n; i++, k++) {
+    acc[k] += static_cast<Accumulator<T>>(data[i]) - static_cast<Accumulator<T>>(ref);
+  }
+  return static_cast<double>(std::accumulate(acc.begin(), acc.end(), Accumulator<T>{0}));
+}
+
+/*!
+\brief Element-wise addition of a contiguous column into another one.
+\param dst Pointer to the first element of the destination
+\param src Pointer to the first element of the source
+\param n Number of elements
+*/
+template <typename T>
+inline void add(T *dst, const T *src, const std::size_t n) {
+  std::size_t i = 0;
+  for(; i + LANES <= n; i += LANES) {
+    for(std::size_t k = 0; k < LANES; k++) {
+      dst[i + k] += src[i + k];
+    }
+  }
+  for(; i < n; i++) {
+    dst[i] += src[i];
+  }
+}
+
+/*!
+\brief Minimum and maximum of a contiguous column.
+\param data Pointer to the first element
+\param n Number of elements
+\return Pair (min, max). If the column is empty, (max, lowest) is returned.
+*/
+template <typename T>
+[[nodiscard]] inline std::pair<T, T> minmax(const T *data, const std::size_t n) {
+  std::array<T, LANES> lo;
+  std::array<T, LANES> hi;
+  lo.fill(std::numeric_limits<T>::max());
+  hi.fill(std::numeric_limits<T>::lowest());
+  std::size_t i = 0;
+  for(; i + LANES <= n; i += LANES) {
+    for(std::size_t k = 0; k < LANES; k++) {
+      lo[k] = data[i + k] < lo[k] ? data[i + k] : lo[k];
+      hi[k] = data[i + k] > hi[k] ? data[i + k] : hi[k];
+    }
+  }
+  for(std::size_t k = 0; i < n; i++, k++) {
+    lo[k] = data[i] < lo[k] ? data[i] : lo[k];
+    hi[k] = data[i] > hi[k] ? data[i] : hi[k];
+  }
+  return {*std::min_element(lo.begin(), lo.end()), *std::max_element(hi.begin(), hi.end())};
+}
+} // namespace simd
+} // namespace ev
+
+#endif // OPENEV_CORE_SIMD_HPP
@@ -0,0 +1,25 @@
+/*!
+\file traits.hpp
+\brief Traits and constants shared by event containers and bulk algorithms.
+\author Raul Tapia
+*/
+#ifndef OPENEV_CORE_TRAITS_HPP
+#define OPENEV_CORE_TRAITS_HPP
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace ev {
+constexpr std::size_t MIN_EVENTS_PER_THREAD = 1 << 16; /*!< Minimum number of events per thread in multi-threaded bulk operations (e.g., Mat::Counter_::insert or describe) */
+
+/*! \cond INTERNAL */
+template <typename C, typename = void>
+struct HasColumns : std::false_type {};
+
+template <typename C>
+struct HasColumns<C, std::void_t<decltype(std::declval<const C &>().x().data()), decltype(std::declval<const C &>().y().data()), decltype(std::declval<const C &>().t().data()), decltype(std::declval<const C &>().p().data())>> : std::true_type {};
+/*! \endcond */
+} // namespace ev
+
+#endif // OPENEV_CORE_TRAITS_HPP
@@ -16,6 +16,7 @@
 #include <opencv2/core/utils/logger.hpp>
 #include <ostream>
 #include <string>
+#include <type_traits>
 
 namespace ev {
 constexpr bool POSITIVE = true;  /*!< Positive polarity */
@@ -51,12 +52,17 @@ using Eventf = Event_<float>;
 using Eventd = Event_<double>;
 using Event = Eventi;
 \endcode
+
+The timestamp type is given by the second template parameter (timebase). By default, timestamps are stored as double. Integer timebases (e.g., int64_t or uint32_t microseconds, as provided by the camera drivers) avoid floating-point conversions and, in the case of uint32_t, halve the memory used by timestamps:
+\code{.cpp}
+using EventMicroseconds = Event_<int, int64_t>;
+\endcode
 */
-template <typename T>
+template <typename T, typename Tt = double>
 class Event_ : public cv::Point_<T> {
 public:
-  double t; /*!< Event timestamp */
-  bool p;   /*!< Event polarity */
+  Tt t;   /*!< Event timestamp */
+  bool p; /*!< Event polarity */
 
   /*!
   Default constructor.
@@ -70,12 +76,12 @@ public:
   /*!
   Copy constructor.
   */
-  Event_(const Event_<T> &) = default;
+  Event_(const Event_<T, Tt> &) = default;
 
   /*!
   Move constructor.
   */
-  Event_(Event_<T> &&) noexcept = default;
+  Event_(Event_<T, Tt> &&) noexcept = default;
 
   /*!
   Contructor using event coordinates.
@@ -97,7 +103,7 @@ public:
   \param t Timestamp
   \param p Polarity
   */
-  Event_(const T x, const T y, const double t, const bool p) : cv::Point_<T>(x, y), t{t}, p{p} {};
+  Event_(const T x, const T y, const Tt t, const bool p) : cv::Point_<T>(x, y), t{t}, p{p} {};
 
   /*!
   Contructor using timestamp, event coordinates as cv::Point, and polarity.
@@ -105,75 +111,75 @@ public:
   \param t Timestamp
   \param p Polarity
   */
-  Event_(const cv::Point_<T> &pt, const double t, const bool p) : cv::Point_<T>(pt), t{t}, p{p} {};
+  Event_(const cv::Point_<T> &pt, const Tt t, const bool p) : cv::Point_<T>(pt), t{t}, p{p} {};
 
   /*!
   Copy assignment operator
   */
-  Event_<T> &operator=(const Event_<T> &) = default;
+  Event_<T, Tt> &operator=(const Event_<T, Tt> &) = default;
 
   /*!
   Copy assignment operator
   */
-  template <typename U>
-  Event_<T> &operator=(const Event_<U> &e) {
-    Event_<T>::x = static_cast<T>(e.x);
-    Event_<T>::y = static_cast<T>(e.y);
-    Event_<T>::t = static_cast<double>(e.t);
-    Event_<T>::p = static_cast<bool>(e.p);
+  template <typename U, typename Ut>
+  Event_<T, Tt> &operator=(const Event_<U, Ut> &e) {
+    Event_<T, Tt>::x = static_cast<T>(e.x);
+    Event_<T, Tt>::y = static_cast<T>(e.y);
+    Event_<T, Tt>::t = static_cast<Tt>(e.t);
+    Event_<T, Tt>::p = static_cast<bool>(e.p);
     return *this;
   }
 
   /*!
   Copy assignment operator
   */
-  Event_<T> &operator=(const cv::Point3_<T> &p) {
-    Event_<T>::x = static_cast<T>(p.x);
-    Event_<T>::y = static_cast<T>(p.y);
-    Event_<T>::t = static_cast<double>(p.z);
+  Event_<T, Tt> &operator=(const cv::Point3_<T> &p) {
+    Event_<T, Tt>::x = static_cast<T>(p.x);
+    Event_<T, Tt>::y = static_cast<T>(p.y);
+    Event_<T, Tt>::t = static_cast<Tt>(p.z);
     return *this;
   }
 
   /*!
   Copy assignment operator
   */
-  Event_<T> &operator=(const cv::Point_<T> &p) {
-    Event_<T>::x = static_cast<T>(p.x);
-    Event_<T>::y = static_cast<T>(p.y);
+  Event_<T, Tt> &operator=(const cv::Point_<T> &p) {
+    Event_<T, Tt>::x = static_cast<T>(p.x);
+    Event_<T, Tt>::y = static_cast<T>(p.y);
     return *this;
   }
 
   /*!
   Move assignment operator
   */
-  Event_<T> &operator=(Event_<T> &&) noexcept = default;
+  Event_<T, Tt> &operator=(Event_<T, Tt> &&) noexcept = default;
 
   /*!
   Equality operator
   */
-  [[nodiscard]] inline bool operator==(const Event_<T> &e) const {
-    return (Event_<T>::x == e.x) && (Event_<T>::y == e.y) && (t == e.t) && (p == e.p);
+  [[nodiscard]] inline bool operator==(const Event_<T, Tt> &e) const {
+    return (Event_<T, Tt>::x == e.x) && (Event_<T, Tt>::y == e.y) && (t == e.t) && (p == e.p);
   }
 
   /*!
   cv::Point equality operator
   */
   [[nodiscard]] inline bool operator==(const cv::Point_<T> &pt) const {
-    return (Event_<T>::x == pt.x) && (Event_<T>::y == pt.y);
+    return (Event_<T, Tt>::x == pt.x) && (Event_<T, Tt>::y == pt.y);
   }
 
   /*!
   cv::Point3 equality operator
   */
   [[nodiscard]] inline bool operator==(const cv::Point3_<T> &pt) const {
-    return (Event_<T>::x == pt.x) && (Event_<T>::y == pt.y) && (Event_<T>::t == pt.z);
+    return (Event_<T, Tt>::x == pt.x) && (Event_<T, Tt>::y == pt.y) && (Event_<T, Tt>::t == pt.z);
   }
 
   /*!
   Comparison operator
   */
-  [[nodiscard]] inline bool operator<(const Event_<T> &e) const {
-    return Event_<T>::t < e.t;
+  [[nodiscard]] inline bool operator<(const Event_<T, Tt> &e) const {
+    return Event_<T, Tt>::t < e.t;
   }
 
   /*!
@@ -181,7 +187,7 @@ public:
   */
   template <typename U>
   [[nodiscard]] inline explicit operator cv::Point_<U>() const {
-    return {static_cast<U>(Event_<T>::x), static_cast<U>(Event_<T>::y)};
+    return {static_cast<U>(Event_<T, Tt>::x), static_cast<U>(Event_<T, Tt>::y)};
   }
 
   /*!
@@ -189,7 +195,7 @@ public:
   */
   template <typename U>
   [[nodiscard]] inline explicit operator cv::Point3_<U>() const {
-    return {static_cast<U>(Event_<T>::x), static_cast<U>(Event_<T>::y), static_cast<U>(Event_<T>::t)};
+    return {static_cast<U>(Event_<T, Tt>::x), static_cast<U>(Event_<T, Tt>::y), static_cast<U>(Event_<T, Tt>::t)};
   }
 
   /*!
@@ -199,15 +205,15 @@ public:
   \return Distance
   \see Distance
   */
-  [[nodiscard]] inline double distance(const Event_<T> &e, const uint8_t type = DISTANCE_NORM_L2 | DISTANCE_FLAG_SPATIAL) const {
+  [[nodiscard]] inline double distance(const Event_<T, Tt> &e, const uint8_t type = DISTANCE_NORM_L2 | DISTANCE_FLAG_SPATIAL) const {
     if(static_cast<bool>(type & DISTANCE_FLAG_SPATIOTEMPORAL)) {
-      return cv::norm(cv::Matx<T, 3, 1>(Event_<T>::x - e.x, Event_<T>::y - e.y, Event_<T>::t - e.t), type & 0x0FU);
+      return cv::norm(cv::Matx<T, 3, 1>(Event_<T, Tt>::x - e.x, Event_<T, Tt>::y - e.y, static_cast<double>(Event_<T, Tt>::t) - static_cast<double>(e.t)), type & 0x0FU);
     }
     if(static_cast<bool>(type & DISTANCE_FLAG_SPATIAL) || !static_cast<bool>(type & 0xF0U)) {
-      return cv::norm(cv::Matx<T, 2, 1>(Event_<T>::x - e.x, Event_<T>::y - e.y), type & 0x0FU);
+      return cv::norm(cv::Matx<T, 2, 1>(Event_<T, Tt>::x - e.x, Event_<T, Tt>::y - e.y), type & 0x0FU);
     }
     if(static_cast<bool>(type & DISTANCE_FLAG_TEMPORAL)) {
-      return Event_<T>::t - e.t;
+      return static_cast<double>(Event_<T, Tt>::t) - static_cast<double>(e.t);
     }
     CV_LOG_ERROR(nullptr, "Bad distance option");
     return 0.0;
@@ -219,7 +225,7 @@ public:
   \param e Event to print
   \return Output stream
   */
-  [[nodiscard]] friend std::ostream &operator<<(std::ostream &os, const Event_<T> &e) {
+  [[nodiscard]] friend std::ostream &operator<<(std::ostream &os, const Event_<T, Tt> &e) {
     os << std::string("(" + std::to_string(e.x) + "," + std::to_string(e.y) + ") " + std::to_string(e.t) + (e.p ? " [+]" : " [-]"));
     return os;
   }
@@ -242,9 +248,9 @@ using AugmentedEventd = AugmentedEvent_<double>;
 using AugmentedEvent = AugmentedEventi;
 \endcode
 */
-template <typename T>
-class AugmentedEvent_ : public Event_<T> {
-  using Event_<T>::Event_;
+template <typename T, typename Tt = double>
+class AugmentedEvent_ : public Event_<T, Tt> {
+  using Event_<T, Tt>::Event_;
 
 public:
   double weight{1};            /*!< Event weight */
@@ -257,7 +263,7 @@ public:
   \param e Event to print
   \return Output stream
   */
-  [[nodiscard]] friend std::ostream &operator<<(std::ostream &os, const AugmentedEvent_<T> &e) {
+  [[nodiscard]] friend std::ostream &operator<<(std::ostream &os, const AugmentedEvent_<T, Tt> &e) {
     os << std::string("(" + std::to_string(e.x) + "," + std::to_string(e.y) + ") " + std::to_string(e.t) + (e.p ? " [+]" : " [-]"));
     os << " w=" + std::to_string(e.weight);
     os << " d=" + std::to_string(e.depth);
@@ -271,6 +277,96 @@ using AugmentedEventf = AugmentedEvent_<float>;  /*!< Alias for AugmentedEvent_
 using AugmentedEventd = AugmentedEvent_<double>; /*!< Alias for AugmentedEvent_ using double */
 using AugmentedEvent = AugmentedEventi;          /*!< Alias for AugmentedEvent_ using int */
 
+/*!
+\brief This class implements a compact event with integer timestamp.
+
+Packed events store the spatial coordinates as 16-bit unsigned integers and the timestamp as a 64-bit signed integer (e.g., microseconds, as provided by the camera drivers). A packed event occupies 16 bytes, whereas Eventi occupies 24 bytes.
+
+Conversion to Event_<T> is implicit and lossless. Conversion from Event_<T> is explicit and lossless as long as coordinates fit in 16 bits and timestamps are integral.
+*/
+class PackedEvent {
+public:
+  int64_t t;  /*!< Event timestamp */
+  uint16_t x; /*!< Spatial coordinate x */
+  uint16_t y; /*!< Spatial coordinate y */
+  bool p;     /*!< Event polarity */
+
+  /*!
+  Default constructor.
+  */
+  PackedEvent() : t{0}, x{0}, y{0}, p{POSITIVE} {};
+
+  /*!
+  Contructor using timestamp, event coordinates, and polarity.
+  \param x Spatial coordinate x
+  \param y Spatial coordinate y
+  \param t Timestamp
+  \param p Polarity
+  */
+  PackedEvent(const uint16_t x, const uint16_t y, const int64_t t, const bool p) : t{t}, x{x}, y{y}, p{p} {};
+
+  /*!
+  Contructor using an event.
+  \param e Event to pack
+  \note Floating-point coordinates and timestamps are rounded to the nearest integer.
+  */
+  template <typename T, typename Tt>
+  explicit PackedEvent(const Event_<T, Tt> &e) : t{packTime(e.t)}, x{pack(e.x)}, y{pack(e.y)}, p{e.p} {};
+
+  /*!
+  Event cast operator
+  */
+  template <typename T, typename Tt>
+  [[nodiscard]] inline operator Event_<T, Tt>() const {
+    return {static_cast<T>(x), static_cast<T>(y), static_cast<Tt>(t), p};
+  }
+
+  /*!
+  Equality operator
+  */
+  [[nodiscard]] inline bool operator==(const PackedEvent &e) const {
+    return (x == e.x) && (y == e.y) && (t == e.t) && (p == e.p);
+  }
+
+  /*!
+  Comparison operator
+  */
+  [[nodiscard]] inline bool operator<(const PackedEvent &e) const {
+    return t < e.t;
+  }
+
+  /*!
+  \brief Overload of << operator.
+  \param os Output stream
+  \param e Event to print
+  \return Output stream
+  */
+  [[nodiscard]] friend std::ostream &operator<<(std::ostream &os, const PackedEvent &e) {
+    os << std::string("(" + std::to_string(e.x) + "," + std::to_string(e.y) + ") " + std::to_string(e.t) + (e.p ? " [+]" : " [-]"));
+    return os;
+  }
+
+private:
+  template <typename T>
+  static inline uint16_t pack(const T value) {
+    if constexpr(std::is_floating_point_v<T>) {
+      return static_cast<uint16_t>(std::lround(value));
+    } else {
+      return static_cast<uint16_t>(value);
+    }
+  }
+
+  template <typename Tt>
+  static inline int64_t packTime(const Tt value) {
+    if constexpr(std::is_floating_point_v<Tt>) {
+      return std::llround(value);
+    } else {
+      return static_cast<int64_t>(value);
+    }
+  }
+};
+static_assert(sizeof(PackedEvent) == 16, "PackedEvent is expected to be 16 bytes");
+
 /*!
 \brief This class extends cv::Size_<T> for event data. For more information, please refer <a href="https://docs.opencv.org/master/d6/d50/classcv_1_1Size__.html">here</a>.
 
@@ -438,8 +534,8 @@ public:
   \return True if the event is inside
   \warning OpenCV typically assumes that the top and left boundary of the rectangle are inclusive, while the right and bottom are not.
   */
-  template <typename Te>
-  [[nodiscard]] inline bool contains(const Event_<Te> &e) const {
+  template <typename Te, typename Tt>
+  [[nodiscard]] inline bool contains(const Event_<Te, Tt> &e) const {
     return cv::Rect_<T>::contains(e) && e.t >= t && e.t < t + length;
   }
 
@@ -509,9 +605,11 @@ struct alignas(16) Circ_ {
   \return True if the event is inside
   \warning This function assumes that the boundary of the circle is inclusive.
   */
-  template <typename Te>
-  [[nodiscard]] inline bool contains(const Event_<Te> &e) const {
-    return !empty() && pow(center.x - e.x, 2) + pow(center.y - e.y, 2) <= radius * radius;
+  template <typename Te, typename Tt>
+  [[nodiscard]] inline bool contains(const Event_<Te, Tt> &e) const {
+    const double dx = static_cast<double>(center.x) - static_cast<double>(e.x);
+    const double dy = static_cast<double>(center.y) - static_cast<double>(e.y);
+    return !empty() && dx * dx + dy * dy <= static_cast<double>(radius) * static_cast<double>(radius);
   }
 
   [[nodiscard]] inline cv::Size size() const {
@@ -0,0 +1,188 @@
+/*!
+\file unwrap.hpp
+\brief Streaming timestamp unwrapping and monotonicity repair.
+\author Raul Tapia
+*/
+#ifndef OPENEV_CORE_UNWRAP_HPP
+#define OPENEV_CORE_UNWRAP_HPP
+
+#include "openev/core/traits.hpp"
+#include "openev/core/types.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace ev {
+/*!
+\brief Policy for events whose timestamp is slightly older than the previous one.
+*/
+enum class OrderPolicy : uint8_t {
+  FLAG,  /*!< Keep the timestamp and count the event as reordered */
+  REPAIR /*!< Clamp the timestamp to the previous one and count the event as reordered */
+};
+
+/*!
+\brief This class implements a streaming stage that unwraps timestamps and checks their monotonicity.
+
+Event cameras provide timestamps with a limited number of bits (e.g., DAVIS timestamps are 32-bit microseconds, which wrap around after about 71 minutes). This stage keeps track of the wrap-arounds and adds the corresponding offset to the timestamps, so that they are monotonic across the whole capture. It can be placed between any reader or camera and the consumers.
+
+A backward jump larger than the tolerance is considered a wrap-around. A backward jump smaller than or equal to the tolerance is considered a reordering, which is flagged or repaired according to the policy. After a wrap-around, a forward jump larger than the tolerance is considered a late event from before the wrap-around only if, one period earlier, it falls within the tolerance behind the previous timestamp. Otherwise, it is accepted as a gap in the stream.
+
+Containers with a timestamp column (e.g., EventBatch_) are processed in blocks: blocks that are monotonic and do not wrap only need one addition per event, which is vectorized.
+
+\code{.cpp}
+ev::TimestampUnwrapper unwrapper;
+ev::Event e;
+while(camera.getEvent(e)) {
+  unwrapper(e); // e.t is now monotonic
+}
+\endcode
+\note The timestamp type must have at least 64 bits.
+*/
+template <typename Tt = double>
+class TimestampUnwrapper_ {
+  static_assert(sizeof(Tt) >= 8, "TimestampUnwrapper_: timestamp type must have at least 64 bits");
+
+public:
+  /*!
+  Constructor.
+  \param period Period of the raw timestamps, i.e., the value added to the timestamps after each wrap-around
+  \param policy Policy for reordered events
+  \param tolerance Maximum backward jump considered a reordering. By default, half the period.
+  */
+  explicit TimestampUnwrapper_(const Tt period = static_cast<Tt>(uint64_t{1} << 32), const OrderPolicy policy = OrderPolicy::FLAG, const Tt tolerance = Tt{0}) : period_{period}, tolerance_{tolerance > Tt{0} ? tolerance : period / 2}, policy_{policy} {}
+
+  /*!
+  \brief Unwrap the timestamp of an event.
+  \param e Event. Its timestamp is modified in place.
+  \return True if the event is in order, false if it has been flagged or repaired
+  */
+  template <typename T>
+  inline bool operator()(Event_<T, Tt> &e) {
+    return process(e.t);
+  }
+
+  /*!
+  \brief Unwrap n timestamps.
+  \param t Timestamps. They are modified in place.
+  \param n Number of timestamps
+  \return Number of events that have been flagged or repaired
+  */
+  inline std::size_t operator()(Tt *t, const std::size_t n) {
+    const std::size_t before = reordered_;
+    std::size_t i = 0;
+    if(!first_) {
+      for(; i + BLOCK <= n; i += BLOCK) {
+        if(!monotonic(t + i)) {
+          for(std::size_t k = 0; k < BLOCK; k++) {
+            process(t[i + k]);
+          }
+          continue;
+        }
+        for(std::size_t k = 0; k < BLOCK; k++) {
+          t[i + k] += offset_;
+        }
+        last_ = t[i + BLOCK - 1];
+      }
+    }
+    for(; i < n; i++) {
+      process(t[i]);
+    }
+    return reordered_ - before;
+  }
+
+  /*!
+  \brief Unwrap the timestamps of a container.
+  \param container Container of events (e.g., Vector_) or with a timestamp column (e.g., EventBatch_). Timestamps are modified in place.
+  \return Number of events that have been flagged or repaired
+  */
+  template <typename Container>
+  inline std::size_t operator()(Container &container) {
+    if constexpr(HasColumns<Container>::value) {
+      return operator()(container.t().data(), container.size());
+    } else {
+      const std::size_t before = reordered_;
+      for(auto &e : container) {
+        process(e.t);
+      }
+      return reordered_ - before;
+    }
+  }
+
+  /*!
+  \brief Restart unwrapping, e.g., after the source has been reset.
+  */
+  inline void reset() {
+    offset_ = Tt{0};
+    last_ = Tt{0};
+    first_ = true;
+    wraps_ = 0;
+    reordered_ = 0;
+  }
+
+  /*!
+  \brief Offset currently added to the timestamps.
+  \return Offset
+  */
+  [[nodiscard]] inline Tt offset() const { return offset_; }
+
+  /*!
+  \brief Number of wrap-arounds detected.
+  \return Number of wrap-arounds
+  */
+  [[nodiscard]] inline std::size_t wraps() const { return wraps_; }
+
+  /*!
+  \brief Number of events that have been flagged or repaired.
+  \return Number of reordered events
+  */
+  [[nodiscard]] inline std::size_t reordered() const { return reordered_; }
+
+private:
+  static constexpr std::size_t BLOCK = 16;
+
+  Tt period_;
+  Tt tolerance_;
+  OrderPolicy policy_;
+  Tt offset_{0};
+  Tt last_{0};
+  bool first_{true};
+  std::size_t wraps_{0};
+  std::size_t reordered_{0};
+
+  [[nodiscard]] inline bool monotonic(const Tt *t) const {
+    bool ok = (t[0] + offset_ >= last_) & (t[0] + offset_ - last_ <= tolerance_);
+    for(std::size_t k = 1; k < BLOCK; k++) {
+      ok &= (t[k] >= t[k - 1]) & (t[k] - t[k - 1] <= tolerance_);
+    }
+    return ok;
+  }
+
+  inline bool process(Tt &t) {
+    Tt u = t + offset_;
+    if(first_) {
+      first_ = false;
+    } else if(u < last_) {
+      if(last_ - u > tolerance_) {
+        offset_ += period_;
+        u += period_;
+        wraps_++;
+      } else {
+        reordered_++;
+        t = policy_ == OrderPolicy::REPAIR ? last_ : u;
+        return false;
+      }
+    } else if(u - last_ > tolerance_ && wraps_ > 0 && u - period_ <= last_ && last_ - (u - period_) <= tolerance_) {
+      reordered_++;
+      t = policy_ == OrderPolicy::REPAIR ? last_ : u - period_;
+      return false;
+    }
+    t = u;
+    last_ = u;
+    return true;
+  }
+};
+using TimestampUnwrapper = TimestampUnwrapper_<double>;   /*!< Alias for TimestampUnwrapper_ using double */
+using TimestampUnwrapperl = TimestampUnwrapper_<int64_t>; /*!< Alias for TimestampUnwrapper_ using int64_t */
+} // namespace ev
+
+#endif // OPENEV_CORE_UNWRAP_HPP
@@ -0,0 +1 @@
+#include "openev/core/sensor.hpp"
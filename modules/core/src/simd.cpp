@@ -0,0 +1 @@
+#include "openev/core/simd.hpp"
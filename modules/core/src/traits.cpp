@@ -0,0 +1 @@
+#include "openev/core/traits.hpp"
@@ -0,0 +1,129 @@
+#include "openev/core/codec.hpp"
+#include "openev/core/types.hpp"
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+TEST(CodecTest, DavisLayout) {
+  const uint64_t data = ev::raw::encode(ev::Event(5, 7, 1000.0, true));
+  EXPECT_EQ(data, (uint64_t{5} << 49) | (uint64_t{7} << 34) | (uint64_t{1} << 33) | (uint64_t{1} << 32) | 1000U);
+  ev::raw::Decoder decoder;
+  EXPECT_EQ(decoder.decode(data), ev::Event(5, 7, 1000.0, true));
+  decoder.reset();
+  EXPECT_EQ(decoder.decode(ev::raw::encode(ev::Event(32767, 0, 0.0, false))), ev::Event(32767, 0, 0.0, false));
+}
+
+TEST(CodecTest, RoundTrip) {
+  std::vector<ev::Event_<int, int64_t>> events;
+  for(int i = 0; i < 101; i++) {
+    events.emplace_back((i * 37) % 640, (i * 53) % 480, 10 * i, i % 3 == 0);
+  }
+  std::vector<uint64_t> data;
+  ev::raw::encode(events, data);
+  ASSERT_EQ(data.size(), events.size());
+  for(std::size_t i = 0; i < events.size(); i++) {
+    EXPECT_EQ(data[i], ev::raw::encode(events[i]));
+  }
+
+  std::vector<ev::Event_<int, int64_t>> decoded;
+  ev::raw::Decoder decoder;
+  decoder.decode(data, decoded);
+  EXPECT_EQ(decoded, events);
+
+  std::vector<int> x(data.size());
+  std::vector<int> y(data.size());
+  std::vector<int64_t> t(data.size());
+  std::vector<uint8_t> p(data.size());
+  decoder.reset();
+  decoder.decode(data.data(), data.size(), x.data(), y.data(), t.data(), p.data());
+  for(std::size_t i = 0; i < events.size(); i++) {
+    EXPECT_EQ((ev::Event_<int, int64_t>(x[i], y[i], t[i], p[i])), events[i]);
+  }
+
+  std::vector<uint64_t> columns(data.size());
+  ev::raw::encode(x.data(), y.data(), t.data(), p.data(), x.size(), columns.data());
+  EXPECT_EQ(columns, data);
+}
+
+TEST(CodecTest, WrapAround) {
+  const std::vector<uint64_t> data{0xFFFFFFF0U, 0xFFFFFFFFU, 0x00000005U, 0x00000010U, 0x7FFFFFFFU, 0xFFFFFFFFU, 0x00000001U};
+  ev::raw::Decoder decoder;
+  std::vector<ev::Event_<int, int64_t>> decoded;
+  decoder.decode(std::vector<uint64_t>(data.begin(), data.begin() + 3), decoded);
+  decoder.decode(std::vector<uint64_t>(data.begin() + 3, data.end()), decoded);
+  ASSERT_EQ(decoded.size(), 7U);
+  EXPECT_EQ(decoded[1].t, 0xFFFFFFFFLL);
+  EXPECT_EQ(decoded[2].t, 0x100000005LL);
+  EXPECT_EQ(decoded[3].t, 0x100000010LL);
+  EXPECT_EQ(decoded[5].t, 0x1FFFFFFFFLL);
+  EXPECT_EQ(decoded[6].t, 0x200000001LL);
+  EXPECT_EQ(decoder.offset(), uint64_t{2} << 32);
+}
+
+TEST(CodecTest, OutOfOrder) {
+  std::vector<uint64_t> data;
+  for(uint64_t t = 1000; t < 1040; t++) {
+    data.push_back(t == 1020 ? 1015 : t);
+  }
+  data.push_back(0xFFFFFFF0U);
+  data.push_back(0x00000005U);
+  data.push_back(0xFFFFFFF8U);
+  data.push_back(0x00000006U);
+  ev::raw::Decoder decoder;
+  std::vector<ev::Event_<int, int64_t>> decoded;
+  decoder.decode(data, decoded);
+  ASSERT_EQ(decoded.size(), data.size());
+  EXPECT_EQ(decoded[20].t, 1015);
+  EXPECT_EQ(decoded[21].t, 1021);
+  EXPECT_EQ(decoded[39].t, 1039);
+  EXPECT_EQ(decoded[40].t, 0xFFFFFFF0LL);
+  EXPECT_EQ(decoded[41].t, 0x100000005LL);
+  EXPECT_EQ(decoded[42].t, 0xFFFFFFF8LL);
+  EXPECT_EQ(decoded[43].t, 0x100000006LL);
+  EXPECT_EQ(decoder.offset(), uint64_t{1} << 32);
+  EXPECT_EQ(decoder.reordered(), 2U);
+}
+
+TEST(CodecTest, TimeScale) {
+  ev::raw::Decoder decoder(1e-6);
+  EXPECT_DOUBLE_EQ(decoder.decode(ev::raw::encode(ev::Event(1, 2, 1.5, true), 1e-6)).t, 1.5);
+}
+
+#if defined(__AVX2__)
+TEST(CodecTest, Avx2MatchesScalar) {
+  using ev::raw::BLOCK;
+  std::mt19937_64 rng(7);
+  std::uniform_int_distribution<int32_t> coordinate(-40000, 40000);
+  for(int n = 0; n < 100; n++) {
+    int32_t x[BLOCK];
+    int32_t y[BLOCK];
+    uint32_t t[BLOCK];
+    uint8_t p[BLOCK];
+    for(std::size_t k = 0; k < BLOCK; k++) {
+      x[k] = coordinate(rng);
+      y[k] = coordinate(rng);
+      t[k] = static_cast<uint32_t>(rng());
+      p[k] = static_cast<uint8_t>(rng());
+    }
+    uint64_t encoded[BLOCK];
+    ev::raw::encodeBlock(x, y, t, p, encoded);
+    for(std::size_t k = 0; k < BLOCK; k++) {
+      const uint64_t expected = (static_cast<uint64_t>(static_cast<uint32_t>(x[k]) & ev::raw::MASK_XY) << ev::raw::SHIFT_X) | (static_cast<uint64_t>(static_cast<uint32_t>(y[k]) & ev::raw::MASK_XY) << ev::raw::SHIFT_Y) | (static_cast<uint64_t>(p[k] & 1U) << ev::raw::SHIFT_P) | (uint64_t{1} << ev::raw::SHIFT_VALID) | t[k];
+      EXPECT_EQ(encoded[k], expected);
+    }
+
+    uint64_t data[BLOCK];
+    for(uint64_t &d : data) {
+      d = rng();
+    }
+    ev::raw::decodeBlock(data, x, y, t, p);
+    for(std::size_t k = 0; k < BLOCK; k++) {
+      EXPECT_EQ(x[k], static_cast<int32_t>((data[k] >> ev::raw::SHIFT_X) & ev::raw::MASK_XY));
+      EXPECT_EQ(y[k], static_cast<int32_t>((data[k] >> ev::raw::SHIFT_Y) & ev::raw::MASK_XY));
+      EXPECT_EQ(t[k], static_cast<uint32_t>(data[k]));
+      EXPECT_EQ(p[k], static_cast<uint8_t>((data[k] >> ev::raw::SHIFT_P) & 1U));
+    }
+  }
+}
+#endif
@@ -1,7 +1,14 @@
 #include "openev/core/matrices.hpp"
+#include "openev/core/sensor.hpp"
+#include "openev/core/traits.hpp"
 #include "openev/core/types.hpp"
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <gtest/gtest.h>
 #include <opencv2/opencv.hpp>
+#include <random>
+#include <vector>
 
 // Test Binary Class
 TEST(BinaryTest, Insert) {
@@ -71,6 +78,74 @@ TEST(TimeTest, StreamOperator) {
   EXPECT_EQ(oss.str(), std::string("Time 15x20"));
 }
 
+TEST(TimeTest, RelativeStorage) {
+  ev::Mat::Timef timef(10, 10);
+  ev::Mat::Timei timei(10, 10);
+  timef.clear();
+  timei.clear();
+  const double t0 = 1e12;
+  timef.emplace(1, 2, t0);
+  timei.emplace(1, 2, t0);
+  timef.emplace(3, 4, t0 + 1000.0);
+  timei.emplace(3, 4, t0 + 1000.4);
+  EXPECT_DOUBLE_EQ(timef.timestamp(1, 2), t0);
+  EXPECT_DOUBLE_EQ(timef.timestamp(3, 4), t0 + 1000.0);
+  EXPECT_DOUBLE_EQ(timei.timestamp(3, 4), t0 + 1000.0);
+  EXPECT_DOUBLE_EQ(timei.timestamp(0, 0), 0.0);
+  EXPECT_EQ(sizeof(ev::Mat::Timef::value_type), sizeof(double) / 2);
+
+  cv::Mat_<float> rel;
+  timef.relative(t0 + 1000.0, rel);
+  EXPECT_FLOAT_EQ(rel(2, 1), -1000.0F);
+  EXPECT_FLOAT_EQ(rel(4, 3), 0.0F);
+  EXPECT_TRUE(std::isinf(rel(0, 0)));
+}
+
+TEST(TimeTest, RollingBase) {
+  ev::Mat::Timef time(4, 4);
+  time.clear();
+  time.emplace(0, 0, 5.0);
+  time.emplace(1, 0, 1.5e7);
+  time.emplace(2, 0, 2e7);
+  EXPECT_GT(time.base(), 0.0);
+  EXPECT_DOUBLE_EQ(time.timestamp(2, 0), 2e7);
+  EXPECT_DOUBLE_EQ(time.timestamp(1, 0), 1.5e7);
+  EXPECT_DOUBLE_EQ(time.timestamp(0, 0), time.base() + 1);
+
+  ev::Mat::Timei timei(4, 4);
+  timei.clear();
+  timei.emplace(0, 0, 0.0);
+  timei.emplace(1, 0, 2e9);
+  timei.emplace(2, 0, 3e9);
+  EXPECT_DOUBLE_EQ(timei.timestamp(2, 0), 3e9);
+  EXPECT_DOUBLE_EQ(timei.timestamp(1, 0), 2e9);
+}
+
+TEST(TimeTest, TickSeconds) {
+  ev::Mat::Timei timei(4, 4);
+  ev::Mat::Timef timef(4, 4);
+  timei.setTick(1e-6);
+  timef.setTick(1e-6);
+  EXPECT_DOUBLE_EQ(timei.tick(), 1e-6);
+  const double t0 = 1700.123456;
+  for(int i = 0; i < 4; i++) {
+    timei.emplace(i, 0, t0 + 0.25 * i + 1e-6 * i);
+    timef.emplace(i, 0, t0 + 0.25 * i + 1e-6 * i);
+  }
+  for(int i = 0; i < 4; i++) {
+    EXPECT_NEAR(timei.timestamp(i, 0), t0 + 0.25 * i + 1e-6 * i, 1e-9);
+    EXPECT_NEAR(timef.timestamp(i, 0), t0 + 0.25 * i + 1e-6 * i, 1e-9);
+  }
+  timef.emplace(0, 1, t0 + 3600.0);
+  EXPECT_NEAR(timef.timestamp(0, 1), t0 + 3600.0, 1e-9);
+  EXPECT_NEAR(timef.timestamp(3, 0), timef.base() + 1e-6, 1e-9);
+
+  cv::Mat_<float> rel;
+  timei.relative(t0 + 0.75 + 3e-6, rel);
+  EXPECT_NEAR(rel(0, 0), -0.75 - 3e-6, 1e-6);
+  EXPECT_NEAR(rel(0, 3), 0.0, 1e-6);
+}
+
 // Test Polarity Class
 TEST(PolarityTest, Insert) {
   ev::Mat::Polarity polarity(10, 10);
@@ -105,6 +180,240 @@ TEST(PolarityTest, StreamOperator) {
   EXPECT_EQ(oss.str(), std::string("Polarity 15x20"));
 }
 
+// Test bit-packed planes
+TEST(PackedTest, BinaryAndPolarity) {
+  ev::Mat::PackedBinary binary(7, 13);
+  ev::Mat::PackedPolarity polarity(7, 13);
+  EXPECT_EQ(binary.size(), cv::Size(13, 7));
+  EXPECT_EQ(binary.count(), 0U);
+  binary.insert(ev::Event(3, 4, 0.0, ev::NEGATIVE));
+  binary.emplace(12.4f, 6.2f);
+  polarity.insert(ev::Event(3, 4, 0.0, ev::POSITIVE));
+  polarity.insert(ev::Event(5, 1, 0.0, ev::NEGATIVE));
+  EXPECT_TRUE(binary.get(3, 4));
+  EXPECT_TRUE(binary.get(12, 6));
+  EXPECT_FALSE(binary.get(4, 3));
+  EXPECT_EQ(binary.count(), 2U);
+  EXPECT_TRUE(polarity.get(3, 4));
+  EXPECT_FALSE(polarity.get(5, 1));
+  EXPECT_EQ(polarity.count(), 1U);
+  EXPECT_TRUE(polarity(4, 3));
+  EXPECT_FALSE(polarity(1, 5));
+  const ev::Mat::Polarity unpacked = polarity.unpack();
+  EXPECT_EQ(unpacked.size(), polarity.size());
+  for(int y = 0; y < 7; y++) {
+    for(int x = 0; x < 13; x++) {
+      EXPECT_EQ(unpacked(y, x), polarity.get(x, y));
+    }
+  }
+  binary.clear();
+  EXPECT_EQ(binary.count(), 0U);
+
+  std::ostringstream oss;
+  [[maybe_unused]] const auto &result = oss << polarity;
+  EXPECT_EQ(oss.str(), std::string("Polarity 13x7"));
+}
+
+TEST(PackedTest, MergeAndMask) {
+  ev::Mat::PackedPolarity a(9, 10);
+  ev::Mat::PackedPolarity b(9, 10);
+  ev::Mat::PackedBinary mask(9, 10);
+  a.emplace(0, 0, true);
+  a.emplace(1, 0, true);
+  b.emplace(2, 0, true);
+  b.emplace(9, 8, true);
+  mask.emplace(1, 0);
+  mask.emplace(9, 8);
+  a.merge(b, mask);
+  EXPECT_TRUE(a.get(0, 0));
+  EXPECT_FALSE(a.get(1, 0));
+  EXPECT_FALSE(a.get(2, 0));
+  EXPECT_TRUE(a.get(9, 8));
+
+  cv::Mat_<uchar> on;
+  cv::Mat_<uchar> off;
+  a.toMask(on, true);
+  a.toMask(off, false);
+  ASSERT_EQ(on.size(), cv::Size(10, 9));
+  for(int y = 0; y < 9; y++) {
+    for(int x = 0; x < 10; x++) {
+      EXPECT_EQ(on(y, x), a.get(x, y) ? 255 : 0);
+      EXPECT_EQ(off(y, x), a.get(x, y) ? 0 : 255);
+    }
+  }
+}
+
+// Test Epoch Class
+TEST(EpochTest, TouchAndResolve) {
+  ev::Mat::Epoch epoch(3, 4);
+  EXPECT_EQ(epoch.size(), cv::Size(4, 3));
+  EXPECT_FALSE(epoch.fresh(1, 2));
+  EXPECT_TRUE(epoch.touch(1, 2));
+  EXPECT_FALSE(epoch.touch(1, 2));
+  EXPECT_TRUE(epoch.fresh(1, 2));
+
+  cv::Mat_<int> m(3, 4, 7);
+  m(2, 1) = 5;
+  epoch.resolve(m, 0);
+  EXPECT_EQ(m(2, 1), 5);
+  EXPECT_EQ(m(0, 0), 0);
+  EXPECT_EQ(m(2, 3), 0);
+
+  epoch.clear();
+  EXPECT_FALSE(epoch.fresh(1, 2));
+  EXPECT_TRUE(epoch.touch(1, 2));
+  epoch.touch();
+  EXPECT_TRUE(epoch.fresh(3, 2));
+}
+
+TEST(EpochTest, WrapAround) {
+  // 8-bit stamps wrap around every 255 clears; a lazily cleared matrix must match an eagerly cleared one across several wraps
+  ev::Mat::Epoch_<ev::DynamicSensor, uint8_t> epoch(5, 7);
+  cv::Mat_<int> lazy(5, 7, 0);
+  cv::Mat_<int> eager(5, 7, 0);
+  std::mt19937 rng(7);
+  std::uniform_int_distribution<int> dx(0, 6);
+  std::uniform_int_distribution<int> dy(0, 4);
+  for(int k = 0; k < 600; k++) {
+    epoch.clear();
+    eager = cv::Mat_<int>(5, 7, 0);
+    for(int i = 0; i < 4; i++) {
+      const int x = dx(rng);
+      const int y = dy(rng);
+      if(epoch.touch(x, y)) {
+        lazy(y, x) = 0;
+      }
+      lazy(y, x)++;
+      eager(y, x)++;
+    }
+    epoch.resolve(lazy, 0);
+    for(int y = 0; y < 5; y++) {
+      for(int x = 0; x < 7; x++) {
+        ASSERT_EQ(lazy(y, x), eager(y, x)) << "clear " << k;
+        ASSERT_EQ(epoch.fresh(x, y), eager(y, x) > 0) << "clear " << k;
+      }
+    }
+  }
+}
+
+// Test TimeRing Class
+TEST(TimeRingTest, InsertAndQueries) {
+  ev::Mat::TimeRing<3> ring(4, 5);
+  EXPECT_EQ(ring.size(), cv::Size(5, 4));
+  EXPECT_EQ(ring.size(2, 1), 0U);
+  EXPECT_EQ(ring.timestamp(2, 1), ev::Mat::TimeRing<3>::EMPTY);
+  ring.insert(ev::Event(2, 1, 10.0, ev::POSITIVE));
+  EXPECT_DOUBLE_EQ(ring.meanInterval(2, 1), 0.0);
+  ring.insert(ev::Event(2, 1, 20.0, ev::NEGATIVE));
+  ring.emplace(2, 1, 25.0, ev::POSITIVE);
+  ring.emplace(2, 1, 40.0, ev::NEGATIVE);
+  EXPECT_EQ(ring.size(2, 1), 3U);
+  EXPECT_DOUBLE_EQ(ring.timestamp(2, 1), 40.0);
+  EXPECT_DOUBLE_EQ(ring.timestamp(2, 1, 2), 20.0);
+  EXPECT_EQ(ring.timestamp(2, 1, 3), ev::Mat::TimeRing<3>::EMPTY);
+  EXPECT_FALSE(ring.polarity(2, 1));
+  EXPECT_TRUE(ring.polarity(2, 1, 1));
+  EXPECT_EQ(ring.count(2, 1, 40.0, 15.0), 2);
+  EXPECT_EQ(ring.count(2, 1, 40.0, 100.0), 3);
+  EXPECT_EQ(ring.count(2, 1, 40.0, 100.0, ev::NEGATIVE), 2);
+  EXPECT_DOUBLE_EQ(ring.meanInterval(2, 1), 10.0);
+
+  cv::Mat_<int> counts;
+  ring.count(40.0, 15.0, counts);
+  EXPECT_EQ(counts(1, 2), 2);
+  EXPECT_EQ(counts(0, 0), 0);
+  cv::Mat_<float> intervals;
+  ring.meanInterval(intervals);
+  EXPECT_FLOAT_EQ(intervals(1, 2), 10.0f);
+
+  ring.clear();
+  EXPECT_EQ(ring.size(2, 1), 0U);
+  EXPECT_EQ(ring.count(2, 1, 40.0, 100.0), 0);
+}
+
+TEST(TimeRingTest, LargeTimestamps) {
+  ev::Mat::TimeRing<2> ring(4, 5);
+  const double t0 = 3600.0 * 1e6;
+  ring.emplace(1, 1, t0 + 1.0, ev::POSITIVE);
+  ring.emplace(1, 1, t0 + 2.0, ev::POSITIVE);
+  EXPECT_DOUBLE_EQ(ring.timestamp(1, 1), t0 + 2.0);
+  EXPECT_DOUBLE_EQ(ring.timestamp(1, 1, 1), t0 + 1.0);
+  EXPECT_EQ(ring.count(1, 1, t0 + 2.0, 0.5), 1);
+  EXPECT_DOUBLE_EQ(ring.meanInterval(1, 1), 1.0);
+}
+
+// Test PolarityCounter Class
+TEST(PolarityCounterTest, SeparateSaturatingChannels) {
+  ev::Mat::PolarityCounter counter(4, 5);
+  counter.clear();
+  EXPECT_EQ(counter.insert(ev::Event(1, 2, 0.0, ev::POSITIVE)), 1);
+  EXPECT_EQ(counter.insert(ev::Event(1, 2, 0.0, ev::NEGATIVE)), 0);
+  EXPECT_EQ(counter(2, 1)[ev::Mat::PolarityCounter::ON], 1);
+  EXPECT_EQ(counter(2, 1)[ev::Mat::PolarityCounter::OFF], 1);
+  for(int i = 0; i < 300; i++) {
+    counter.emplace(4, 3, ev::NEGATIVE);
+  }
+  EXPECT_EQ(counter(3, 4)[ev::Mat::PolarityCounter::OFF], 255);
+  EXPECT_EQ(counter.net(4, 3), -255);
+
+  ev::Mat::PolarityCounterw wide(4, 5);
+  wide.clear();
+  for(int i = 0; i < 300; i++) {
+    wide.emplace(0.2f, 0.4f, ev::POSITIVE);
+  }
+  EXPECT_EQ(wide(0, 0)[ev::Mat::PolarityCounterw::ON], 300);
+  wide.clear();
+  EXPECT_EQ(wide.net(0, 0), 0);
+}
+
+// Test Tiles Class
+TEST(TilesTest, MarkAndRects) {
+  ev::Mat::Tiles tiles(70, 100, 30);
+  EXPECT_EQ(tiles.tile(), 32);
+  EXPECT_EQ(tiles.count(), 0U);
+  tiles.mark(5, 5);
+  tiles.mark(40, 10);
+  tiles.mark(99, 69);
+  EXPECT_TRUE(tiles.dirty(31, 31));
+  EXPECT_FALSE(tiles.dirty(64, 0));
+  EXPECT_EQ(tiles.count(), 3U);
+  const std::vector<cv::Rect> rects = tiles.rects();
+  ASSERT_EQ(rects.size(), 2U);
+  EXPECT_EQ(rects[0], cv::Rect(0, 0, 64, 32));
+  EXPECT_EQ(rects[1], cv::Rect(96, 64, 4, 6));
+
+  cv::Mat_<int> m(70, 100, 0);
+  tiles.fill(m, 1);
+  EXPECT_EQ(m(31, 63), 1);
+  EXPECT_EQ(m(32, 0), 0);
+  EXPECT_EQ(m(69, 99), 1);
+  tiles.clear();
+  EXPECT_EQ(tiles.count(), 0U);
+}
+
+TEST(TilesTest, TrackedClear) {
+  ev::Mat::Counter counter(100, 100);
+  counter.clear();
+  EXPECT_EQ(counter.tiles(), nullptr);
+  counter.track(16);
+  counter.clear();
+  ASSERT_NE(counter.tiles(), nullptr);
+  EXPECT_EQ(counter.tiles()->count(), 0U);
+  counter.emplace(50, 20, ev::POSITIVE);
+  counter.emplace(50, 20, ev::POSITIVE);
+  EXPECT_EQ(counter.tiles()->count(), 1U);
+  counter.clear();
+  EXPECT_EQ(counter(20, 50), 0);
+
+  ev::Mat::Timef time(64, 64);
+  time.track();
+  time.clear();
+  time.emplace(3, 60, 10.0);
+  EXPECT_TRUE(time.tiles()->dirty(3, 60));
+  time.clear();
+  EXPECT_DOUBLE_EQ(time.timestamp(3, 60), 0.0);
+}
+
 // Test Counter Class
 TEST(CounterTest, Insert) {
   ev::Mat::Counter counter(10, 10);
@@ -123,6 +432,69 @@ TEST(CounterTest, Emplace) {
   EXPECT_EQ(counter(6, 5), 3);
 }
 
+TEST(CounterTest, BulkInsert) {
+  std::vector<ev::Event> events;
+  for(std::size_t i = 0; i < 3 * ev::Mat::Counter::MIN_EVENTS_PER_THREAD + 7; i++) {
+    events.emplace_back(static_cast<int>(i % 13), static_cast<int>(i % 11), 0.0, (i % 3) != 0);
+  }
+  ev::Mat::Counter serial(11, 13);
+  ev::Mat::Counter parallel(11, 13);
+  serial.clear();
+  parallel.clear();
+  for(const ev::Event &e : events) {
+    serial.insert(e);
+  }
+  parallel.insert(events, 4);
+  for(int y = 0; y < 11; y++) {
+    for(int x = 0; x < 13; x++) {
+      EXPECT_EQ(parallel(y, x), serial(y, x));
+    }
+  }
+  parallel.insert(events, 1);
+  EXPECT_EQ(parallel(0, 0), 2 * serial(0, 0));
+}
+
+TEST(CounterTest, ColumnarBulkInsert) {
+  // Column layout of EventBatch_ (see ev::HasColumns)
+  struct Columns {
+    std::vector<int> xs;
+    std::vector<int> ys;
+    std::vector<double> ts;
+    std::vector<uint8_t> ps;
+    [[nodiscard]] const std::vector<int> &x() const { return xs; }
+    [[nodiscard]] const std::vector<int> &y() const { return ys; }
+    [[nodiscard]] const std::vector<double> &t() const { return ts; }
+    [[nodiscard]] const std::vector<uint8_t> &p() const { return ps; }
+    [[nodiscard]] std::size_t size() const { return ts.size(); }
+  };
+  static_assert(ev::HasColumns<Columns>::value);
+
+  std::vector<ev::Event> events;
+  Columns columns;
+  for(std::size_t i = 0; i < 2 * ev::MIN_EVENTS_PER_THREAD + 3; i++) {
+    events.emplace_back(static_cast<int>(i % 17), static_cast<int>(i % 5), static_cast<double>(i), i % 4 == 0);
+    columns.xs.push_back(events.back().x);
+    columns.ys.push_back(events.back().y);
+    columns.ts.push_back(events.back().t);
+    columns.ps.push_back(events.back().p);
+  }
+  ev::Mat::Counter expected(5, 17);
+  ev::Mat::Counter counter(5, 17);
+  expected.clear();
+  counter.clear();
+  expected.insert(events, 1);
+  counter.insert(columns, 2);
+  for(int y = 0; y < 5; y++) {
+    for(int x = 0; x < 17; x++) {
+      EXPECT_EQ(counter(y, x), expected(y, x));
+    }
+  }
+  // Partial counters are reused by the next insertion
+  counter.insert(columns, 2);
+  EXPECT_EQ(counter(0, 0), 2 * expected(0, 0));
+  EXPECT_EQ(counter(4, 16), 2 * expected(4, 16));
+}
+
 TEST(CounterTest, Clear) {
   ev::Mat::Counter counter(10, 10);
   counter.emplace(5, 6, ev::POSITIVE);
@@ -145,3 +517,34 @@ TEST(CounterTest, StreamOperator) {
   [[maybe_unused]] const auto &result = oss << counter;
   EXPECT_EQ(oss.str(), std::string("Counter 15x20"));
 }
+
+// Test Sensor Class
+TEST(SensorTest, Contains) {
+  using S = ev::Sensor<4, 3>;
+  EXPECT_TRUE(S::contains(0, 0, 0, 0));
+  EXPECT_TRUE(S::contains(3, 2, 0, 0));
+  EXPECT_FALSE(S::contains(4, 2, 0, 0));
+  EXPECT_FALSE(S::contains(-1, 0, 0, 0));
+  EXPECT_FALSE(S::contains(2.0, 3.0, 0, 0));
+  EXPECT_TRUE(ev::DynamicSensor::contains(9, 9, 10, 10));
+  EXPECT_FALSE(ev::DynamicSensor::contains(-1, 9, 10, 10));
+  EXPECT_FALSE(ev::DynamicSensor::contains(10, 9, 10, 10));
+}
+
+TEST(SensorTest, FixedMatrices) {
+  ev::Mat::Time_<ev::Sensor<4, 3>> time;
+  EXPECT_EQ(time.size(), cv::Size(4, 3));
+  EXPECT_TRUE((ev::Sensor<4, 3>::valid(time)));
+  time.clear();
+  time.emplace(3, 2, 1.5);
+  EXPECT_DOUBLE_EQ(time(2, 3), 1.5);
+  EXPECT_DOUBLE_EQ(time(0, 0), 0.0);
+
+  ev::Mat::Counter_<ev::SensorDavis346> counter;
+  counter.clear();
+  counter.insert(ev::Event(345, 259, 0.0, ev::NEGATIVE));
+  EXPECT_EQ(counter(259, 345), -1);
+
+  EXPECT_TRUE(ev::Mat::Time().empty());
+  EXPECT_FALSE((ev::Sensor<4, 3>::valid(ev::Mat::Time(4, 3))));
+}
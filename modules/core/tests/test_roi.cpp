@@ -0,0 +1,49 @@
+#include "openev/core/roi.hpp"
+#include "openev/core/types.hpp"
+#include <gtest/gtest.h>
+#include <opencv2/opencv.hpp>
+#include <vector>
+
+TEST(MaskROITest, FromMask) {
+  cv::Mat_<uchar> mask(5, 7, static_cast<uchar>(0));
+  mask(2, 3) = 1;
+  mask(4, 6) = 255;
+  const ev::MaskROI roi(mask);
+  EXPECT_EQ(roi.size(), cv::Size(7, 5));
+  EXPECT_EQ(roi.area(), 2U);
+  EXPECT_TRUE(roi.contains(ev::Event(3, 2, 0.0, ev::POSITIVE)));
+  EXPECT_TRUE(roi.contains(6, 4));
+  EXPECT_FALSE(roi.contains(2, 3));
+  EXPECT_FALSE(roi.contains(-1, 0));
+  EXPECT_FALSE(roi.contains(7, 4));
+  EXPECT_TRUE(roi.contains(ev::Eventf(3.4f, 1.6f, 0.0, ev::NEGATIVE)));
+}
+
+TEST(MaskROITest, FromRegion) {
+  const ev::Circ circ(cv::Point(10, 10), 4);
+  const ev::MaskROI roi(cv::Size(20, 20), circ);
+  for(int y = 0; y < 20; y++) {
+    for(int x = 0; x < 20; x++) {
+      EXPECT_EQ(roi.contains(x, y), circ.contains(ev::Event(x, y, 0.0, ev::POSITIVE)));
+    }
+  }
+}
+
+TEST(MaskROITest, FromPolygon) {
+  const ev::MaskROI roi(cv::Size(20, 20), std::vector<cv::Point>{{2, 2}, {17, 2}, {17, 17}, {2, 17}});
+  EXPECT_TRUE(roi.contains(10, 10));
+  EXPECT_TRUE(roi.contains(5, 15));
+  EXPECT_FALSE(roi.contains(0, 0));
+  EXPECT_FALSE(roi.contains(19, 10));
+}
+
+TEST(MaskROITest, Operators) {
+  const ev::MaskROI a(cv::Size(10, 13), ev::Rect(0, 0, 5, 13));
+  const ev::MaskROI b(cv::Size(10, 13), ev::Rect(3, 0, 5, 13));
+  EXPECT_EQ((a | b).area(), 8U * 13U);
+  EXPECT_EQ((a & b).area(), 2U * 13U);
+  EXPECT_EQ((~a).area(), 5U * 13U);
+  EXPECT_FALSE((~a).contains(4, 12));
+  EXPECT_TRUE((~a).contains(5, 12));
+  EXPECT_EQ(ev::MaskROI((~a).toMat()).area(), (~a).area());
+}
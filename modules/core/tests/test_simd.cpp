@@ -0,0 +1,25 @@
+#include "openev/core/simd.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+
+TEST(SimdTest, Sum) {
+  std::vector<int> data(19);
+  for(int i = 0; i < 19; i++) {
+    data[i] = i;
+  }
+  EXPECT_DOUBLE_EQ(ev::simd::sum(data.data(), data.size()), 171.0);
+  EXPECT_DOUBLE_EQ(ev::simd::sum(data.data(), data.size(), 1), 152.0);
+  EXPECT_DOUBLE_EQ(ev::simd::sum(data.data(), 0), 0.0);
+}
+
+TEST(SimdTest, SumRelative) {
+  const std::vector<double> data{1e12 + 0.25, 1e12 + 0.5, 1e12 + 0.75};
+  EXPECT_DOUBLE_EQ(ev::simd::sum(data.data(), data.size(), 1e12), 1.5);
+}
+
+TEST(SimdTest, MinMax) {
+  const std::vector<float> data{3.f, -1.f, 7.f, 2.f, 9.f, 0.f, 5.f, 4.f, -3.f, 8.f};
+  const auto [lo, hi] = ev::simd::minmax(data.data(), data.size());
+  EXPECT_FLOAT_EQ(lo, -3.f);
+  EXPECT_FLOAT_EQ(hi, 9.f);
+}
@@ -193,6 +193,63 @@ TEST(AugmentedEventTest, ModifyWeightDepthStereo) {
   EXPECT_EQ(event.stereo, ev::Stereo::RIGHT);
 }
 
+// Test PackedEvent Class
+TEST(PackedEventTest, Size) {
+  EXPECT_EQ(sizeof(ev::PackedEvent), 16U);
+  EXPECT_LT(sizeof(ev::PackedEvent), sizeof(ev::Event));
+}
+
+TEST(PackedEventTest, ConstructorDefault) {
+  const ev::PackedEvent event;
+  EXPECT_EQ(event.x, 0);
+  EXPECT_EQ(event.y, 0);
+  EXPECT_EQ(event.t, 0);
+  EXPECT_TRUE(event.p);
+}
+
+TEST(PackedEventTest, ConstructorWithXYTPValues) {
+  const ev::PackedEvent event(345, 259, 4294967296123LL, false);
+  EXPECT_EQ(event.x, 345);
+  EXPECT_EQ(event.y, 259);
+  EXPECT_EQ(event.t, 4294967296123LL);
+  EXPECT_FALSE(event.p);
+}
+
+TEST(PackedEventTest, ConversionFromEvent) {
+  const ev::PackedEvent e1(ev::Event(12, 34, 1234567.0, false));
+  EXPECT_EQ(e1, ev::PackedEvent(12, 34, 1234567, false));
+  const ev::PackedEvent e2(ev::Eventd(12.4, 33.6, 1234566.7, true));
+  EXPECT_EQ(e2, ev::PackedEvent(12, 34, 1234567, true));
+}
+
+TEST(PackedEventTest, ConversionToEvent) {
+  const ev::PackedEvent packed(639, 479, 9007199254740991LL, true);
+  const ev::Event event = packed;
+  EXPECT_EQ(event, ev::Event(639, 479, 9007199254740991.0, true));
+  EXPECT_EQ(ev::PackedEvent(event), packed);
+}
+
+TEST(PackedEventTest, ConversionWithIntegerTimebase) {
+  const ev::Event_<int, int64_t> event(10, 20, 9007199254740993LL, false);
+  const ev::PackedEvent packed(event);
+  EXPECT_EQ(packed.t, 9007199254740993LL);
+  EXPECT_EQ((static_cast<ev::Event_<int, int64_t>>(packed)), event);
+}
+
+TEST(PackedEventTest, LessThanOperator) {
+  const ev::PackedEvent e1(1, 2, 3, true);
+  const ev::PackedEvent e2(4, 5, 6, false);
+  EXPECT_TRUE(e1 < e2);
+  EXPECT_FALSE(e2 < e1);
+}
+
+TEST(PackedEventTest, StreamOperator) {
+  const ev::PackedEvent event(1, 2, 3, false);
+  std::ostringstream oss;
+  [[maybe_unused]] const auto &result = oss << event;
+  EXPECT_EQ(oss.str(), std::string("(1,2) 3 [-]"));
+}
+
 // Test Size2 Class
 TEST(Size2Test, ConstructorDefault) {
   const ev::Size2 size;
@@ -326,3 +383,29 @@ TEST(CircTest, SizeMethod) {
   EXPECT_EQ(size.width, 10);
   EXPECT_EQ(size.height, 10);
 }
+
+// Test Event_ timebases
+TEST(TimebaseTest, Size) {
+  EXPECT_EQ(sizeof(ev::Event_<int, uint32_t>), 16U);
+  EXPECT_EQ(sizeof(ev::Event_<int, double>), sizeof(ev::Event));
+  EXPECT_LT(sizeof(ev::Event_<int, uint32_t>), sizeof(ev::Event));
+}
+
+TEST(TimebaseTest, ConversionBetweenTimebases) {
+  const ev::Event_<int, int64_t> e1(1, 2, 1500, true);
+  ev::Event_<float, double> e2;
+  e2 = e1;
+  EXPECT_EQ(e2, (ev::Event_<float, double>(1.0f, 2.0f, 1500.0, true)));
+}
+
+TEST(TimebaseTest, TemporalDistance) {
+  const ev::Event_<int, uint32_t> e1(0, 0, 1000U, true);
+  const ev::Event_<int, uint32_t> e2(0, 0, 3000U, true);
+  EXPECT_DOUBLE_EQ(e1.distance(e2, ev::DISTANCE_FLAG_TEMPORAL), -2000.0);
+}
+
+TEST(TimebaseTest, Containment) {
+  const ev::Rect3_<int> rect(0, 0, 1000, 10, 10, 500);
+  EXPECT_TRUE(rect.contains(ev::Event_<int, int64_t>(5, 5, 1200, true)));
+  EXPECT_FALSE(rect.contains(ev::Event_<int, int64_t>(5, 5, 1500, true)));
+}
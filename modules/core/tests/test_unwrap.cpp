@@ -0,0 +1,88 @@
+#include "openev/core/types.hpp"
+#include "openev/core/unwrap.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <vector>
+
+static constexpr double PERIOD = 4294967296.0;
+
+TEST(TimestampUnwrapperTest, WrapAround) {
+  ev::TimestampUnwrapper unwrapper;
+  ev::Event e(0, 0, PERIOD - 10, ev::POSITIVE);
+  EXPECT_TRUE(unwrapper(e));
+  EXPECT_DOUBLE_EQ(e.t, PERIOD - 10);
+  e.t = 5;
+  EXPECT_TRUE(unwrapper(e));
+  EXPECT_DOUBLE_EQ(e.t, PERIOD + 5);
+  EXPECT_EQ(unwrapper.wraps(), 1U);
+  EXPECT_DOUBLE_EQ(unwrapper.offset(), PERIOD);
+  e.t = 1000;
+  EXPECT_TRUE(unwrapper(e));
+  EXPECT_DOUBLE_EQ(e.t, PERIOD + 1000);
+  EXPECT_EQ(unwrapper.reordered(), 0U);
+}
+
+TEST(TimestampUnwrapperTest, Reordering) {
+  ev::TimestampUnwrapper flag;
+  ev::TimestampUnwrapper repair(PERIOD, ev::OrderPolicy::REPAIR);
+  const std::vector<double> raw = {100, 200, 150, 300, PERIOD - 1, 2, PERIOD - 3, 10};
+  const std::vector<double> flagged = {100, 200, 150, 300, PERIOD - 1, PERIOD + 2, PERIOD - 3, PERIOD + 10};
+  const std::vector<double> repaired = {100, 200, 200, 300, PERIOD - 1, PERIOD + 2, PERIOD + 2, PERIOD + 10};
+  for(std::size_t i = 0; i < raw.size(); i++) {
+    ev::Event a(0, 0, raw[i], ev::POSITIVE);
+    ev::Event b(0, 0, raw[i], ev::POSITIVE);
+    EXPECT_EQ(flag(a), i != 2 && i != 6);
+    EXPECT_EQ(repair(b), i != 2 && i != 6);
+    EXPECT_DOUBLE_EQ(a.t, flagged[i]);
+    EXPECT_DOUBLE_EQ(b.t, repaired[i]);
+  }
+  EXPECT_EQ(flag.reordered(), 2U);
+  EXPECT_EQ(repair.wraps(), 1U);
+}
+
+TEST(TimestampUnwrapperTest, GapAfterWrapAround) {
+  ev::TimestampUnwrapper flag(PERIOD, ev::OrderPolicy::FLAG, 1000);
+  ev::TimestampUnwrapper repair(PERIOD, ev::OrderPolicy::REPAIR, 1000);
+  const std::vector<double> raw = {PERIOD - 10, 5, 50000, 50100, PERIOD - 20, 50200, 60000};
+  const std::vector<double> unwrapped = {PERIOD - 10, PERIOD + 5, PERIOD + 50000, PERIOD + 50100, 2 * PERIOD - 20, 2 * PERIOD + 50200, 2 * PERIOD + 60000};
+  for(std::size_t i = 0; i < raw.size(); i++) {
+    ev::Event a(0, 0, raw[i], ev::POSITIVE);
+    ev::Event b(0, 0, raw[i], ev::POSITIVE);
+    EXPECT_TRUE(flag(a));
+    EXPECT_TRUE(repair(b));
+    EXPECT_DOUBLE_EQ(a.t, unwrapped[i]);
+    EXPECT_DOUBLE_EQ(b.t, unwrapped[i]);
+  }
+  EXPECT_EQ(flag.reordered(), 0U);
+  EXPECT_EQ(repair.wraps(), 2U);
+
+  std::vector<double> block = raw;
+  ev::TimestampUnwrapper columns(PERIOD, ev::OrderPolicy::FLAG, 1000);
+  EXPECT_EQ(columns(block.data(), block.size()), 0U);
+  EXPECT_EQ(block, unwrapped);
+}
+
+TEST(TimestampUnwrapperTest, BlocksMatchScalar) {
+  std::vector<int64_t> raw;
+  int64_t t = 0;
+  for(int i = 0; i < 1000; i++) {
+    t = (t + 7919 * 1000 + (i % 50 == 3 ? -500 : 0)) & 0xFFFFFFFFLL;
+    raw.push_back(t);
+  }
+  std::vector<int64_t> block = raw;
+  std::vector<int64_t> scalar = raw;
+  ev::TimestampUnwrapperl a(int64_t{1} << 32, ev::OrderPolicy::REPAIR);
+  ev::TimestampUnwrapperl b(int64_t{1} << 32, ev::OrderPolicy::REPAIR);
+  const std::size_t n = a(block.data(), 5) + a(block.data() + 5, block.size() - 5);
+  for(int64_t &x : scalar) {
+    ev::Event_<int, int64_t> e(0, 0, x, ev::POSITIVE);
+    b(e);
+    x = e.t;
+  }
+  EXPECT_EQ(block, scalar);
+  EXPECT_EQ(n, b.reordered());
+  EXPECT_EQ(a.wraps(), b.wraps());
+  EXPECT_GT(a.wraps(), 0U);
+  EXPECT_TRUE(std::is_sorted(block.begin(), block.end()));
+}
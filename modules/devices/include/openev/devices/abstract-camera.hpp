@@ -6,6 +6,7 @@
 #ifndef OPENEV_DEVICES_ABSTRACT_CAMERA_HPP
 #define OPENEV_DEVICES_ABSTRACT_CAMERA_HPP
 
+#include "openev/containers/chunk-queue.hpp"
 #include "openev/containers/queue.hpp"
 #include "openev/containers/vector.hpp"
 #include <atomic>
@@ -200,6 +201,16 @@ public:
   */
   virtual bool getData(Queue &events) = 0;
 
+  /*!
+  \brief Get data.
+  \param events Chunk queue to which events will be added, split in chunks of up to ChunkQueue_::chunkSize events.
+  \param block If true, wait for free slots in the queue. Otherwise, chunks that do not fit in the queue are discarded.
+  \return True if events were received and all of them were inserted
+  \note Several cameras (e.g., the two sides of a stereo rig) can feed the same queue from different threads.
+  \warning If block is false, a false return value may also mean that the queue was full and some chunks were discarded.
+  */
+  bool getData(ChunkQueue &events, const bool block = true);
+
 protected:
   /*! \cond INTERNAL */
   std::atomic<bool> running_{false};
@@ -209,6 +220,10 @@ protected:
   /*! \endcond */
 
   virtual void init() = 0;
+
+private:
+  Vector received_;
+  Vector chunk_;
 };
 
 } // namespace ev
@@ -89,6 +89,8 @@ public:
   */
   void enableImu(bool state);
 
+  using AbstractCamera::getData;
+
   /*!
   \brief Get DVS data.
   \param events Event vector to which events will be added
@@ -228,6 +230,7 @@ public:
   Mask for y: 00000000000000011111111111111100 00000000000000000000000000000000
   Mask for p: 00000000000000000000000000000010 00000000000000000000000000000000
   Mask for t: 00000000000000000000000000000000 11111111111111111111111111111111
+  \see ev::raw::Decoder
   */
   void getEventRaw(std::vector<uint64_t> &data);
 
@@ -241,6 +244,7 @@ public:
   Mask for y: 00000000000000011111111111111100 00000000000000000000000000000000
   Mask for p: 00000000000000000000000000000010 00000000000000000000000000000000
   Mask for t: 00000000000000000000000000000000 11111111111111111111111111111111
+  \see ev::raw::Decoder
   */
   std::size_t getEventRaw(uint64_t *data, const bool allow_realloc = true);
 
@@ -6,7 +6,9 @@
 #include "openev/devices/abstract-camera.hpp"
 #include "libcaer/devices/davis.h"
 #include "libcaer/devices/device.h"
+#include <algorithm>
 #include <chrono>
+#include <cstddef>
 
 ev::AbstractCamera::~AbstractCamera() {
   caerDeviceDataStop(deviceHandler_);
@@ -63,6 +65,20 @@ bool ev::AbstractCamera::setBias(const int8_t config_bias, const uint8_t name, c
   return caerDeviceConfigSet(deviceHandler_, config_bias, name, caerBiasCoarseFineGenerate(cf));
 }
 
+bool ev::AbstractCamera::getData(ev::ChunkQueue &events, const bool block /*= true*/) {
+  received_.clear();
+  if(!getData(received_)) {
+    return false;
+  }
+  bool inserted = true;
+  for(std::size_t i = 0; i < received_.size(); i += events.chunkSize()) {
+    const std::size_t n = std::min(events.chunkSize(), received_.size() - i);
+    chunk_.assign(received_.begin() + static_cast<std::ptrdiff_t>(i), received_.begin() + static_cast<std::ptrdiff_t>(i + n));
+    inserted &= block ? events.push(chunk_) : events.try_push(chunk_);
+  }
+  return inserted;
+}
+
 void ev::AbstractCamera::flush(const double msec) const {
   if(msec <= 0) {
     return;
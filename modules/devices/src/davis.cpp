@@ -7,7 +7,9 @@
 #include "openev/containers/queue.hpp"
 #include "openev/containers/vector.hpp"
 #include "openev/devices/abstract-camera.hpp"
+#include <algorithm>
 #include <array>
+#include <cstddef>
 #include <cstdlib>
 #include <cstring>
 #include <libcaer/devices/davis.h>
@@ -222,7 +224,10 @@ void ev::Davis::getData_(T1 *dvs, T2 *aps, T3 *imu) {
         break;
       } else {
         if constexpr(std::is_same_v<T1, ev::Vector>) {
-          dvs->reserve(dvs->size() + static_cast<std::size_t>(packet_size));
+          const std::size_t required = dvs->size() + static_cast<std::size_t>(packet_size);
+          if(required > dvs->capacity()) {
+            dvs->reserve(std::max(required, 2 * dvs->capacity()));
+          }
         }
         for(int32_t k = 0; k < packet_size; k++) {
           const caerPolarityEventConst p = caerPolarityEventPacketGetEventConst(reinterpret_cast<caerPolarityEventPacketConst>(packet), k);
@@ -317,7 +322,10 @@ void ev::Davis::getEventRaw(std::vector<uint64_t> &data) {
       continue;
     }
     const int32_t packet_size = caerEventPacketHeaderGetEventNumber(packet);
-    data.reserve(data.size() + static_cast<std::size_t>(packet_size));
+    const std::size_t required = data.size() + static_cast<std::size_t>(packet_size);
+    if(required > data.capacity()) {
+      data.reserve(std::max(required, 2 * data.capacity()));
+    }
     for(int32_t k = 0; k < packet_size; k++) {
       const caerPolarityEventConst p = caerPolarityEventPacketGetEventConst(reinterpret_cast<caerPolarityEventPacketConst>(packet), k);
       if(p != nullptr) {
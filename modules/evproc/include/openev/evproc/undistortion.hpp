@@ -7,12 +7,15 @@
 #define OPENEV_EVPROC_UNDISTORTION_HPP
 
 #include "openev/containers/array.hpp"
+#include "openev/containers/augmented-batch.hpp"
+#include "openev/containers/batch.hpp"
 #include "openev/containers/vector.hpp"
 #include <algorithm>
 #include <array>
 #include <cstddef>
 #include <opencv2/core/mat.hpp>
 #include <opencv2/core/mat.inl.hpp>
+#include <opencv2/core/saturate.hpp>
 #include <opencv2/core/traits.hpp>
 #include <opencv2/core/types.hpp>
 #include <opencv2/imgproc.hpp>
@@ -49,20 +52,30 @@ public:
     return p.inside(UndistortMap::operator cv::Rect());
   }
 
-  template <typename T, std::size_t N>
-  inline void operator()(Array_<T, N> &array) const {
+  template <typename T, std::size_t N, typename Tt>
+  inline void operator()(Array_<T, N, Tt> &array) const {
     for(std::size_t i = 0; i < N; i++) {
       array[i] = static_cast<cv::Point_<T>>(cv::Mat_<cv::Point_<double>>::ptr<cv::Point_<double>>(static_cast<int>(array[i].y))[static_cast<int>(array[i].x)]);
     }
   }
 
-  template <typename T>
-  inline void operator()(Vector_<T> &vector) const {
+  template <typename T, typename Tt>
+  inline void operator()(Vector_<T, Tt> &vector) const {
     for(std::size_t i = 0; i < vector.size(); i++) {
       vector[i] = static_cast<cv::Point_<T>>(cv::Mat_<cv::Point_<double>>::ptr<cv::Point_<double>>(static_cast<int>(vector[i].y))[static_cast<int>(vector[i].x)]);
     }
   }
 
+  template <typename T, typename Tt>
+  inline void operator()(EventBatch_<T, Tt> &batch) const {
+    apply(batch.x().data(), batch.y().data(), batch.size());
+  }
+
+  template <typename T, typename Tt>
+  inline void operator()(AugmentedEventBatch_<T, Tt> &batch) const {
+    apply(batch.x().data(), batch.y().data(), batch.size());
+  }
+
   inline void operator()(const cv::Mat &src, cv::Mat &dst) {
     cv::remap(src, dst, cvUndistortionMap_[0], cvUndistortionMap_[1], cv::INTER_LINEAR);
   }
@@ -78,6 +91,15 @@ public:
   [[nodiscard]] cv::Mat visualize(const VisualizationOptions options = VisualizationOptions::COLOR) const;
 
 private:
+  template <typename T>
+  inline void apply(T *x, T *y, const std::size_t n) const {
+    for(std::size_t i = 0; i < n; i++) {
+      const cv::Point_<double> &p = cv::Mat_<cv::Point_<double>>::ptr<cv::Point_<double>>(static_cast<int>(y[i]))[static_cast<int>(x[i])];
+      x[i] = cv::saturate_cast<T>(p.x);
+      y[i] = cv::saturate_cast<T>(p.y);
+    }
+  }
+
   void init(const cv::Mat &cam_matrix, const cv::Mat &dist_coeff, const cv::Size &sz);
   std::array<cv::Mat, 2> cvUndistortionMap_;
 };
@@ -6,16 +6,131 @@
 #ifndef OPENEV_EVPROC_VOTING_HPP
 #define OPENEV_EVPROC_VOTING_HPP
 
+#include "openev/containers/augmented-batch.hpp"
+#include "openev/containers/batch.hpp"
 #include "openev/core/types.hpp"
 #include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
 
 namespace ev {
 
+/*!
+\brief Bilinear voting of an event.
+
+The event votes into its four neighbouring pixels (x0, y0), (x0 + 1, y0), (x0, y0 + 1), and (x0 + 1, y0 + 1), where x0 and y0 are the floor of its coordinates.
+\param event Event with sub-pixel coordinates
+\return Bilinear weights of the four votes
+*/
 template <typename T>
-static inline std::array<T, 4> bilinearVoting(Event_<T> event);
+inline std::array<T, 4> bilinearVoting(const Event_<T> &event) {
+  const T dx = event.x - static_cast<T>(std::floor(event.x));
+  const T dy = event.y - static_cast<T>(std::floor(event.y));
+  const T one_minus_dx = 1 - dx;
+  const T one_minus_dy = 1 - dy;
+  return {one_minus_dx * one_minus_dy, dx * one_minus_dy, one_minus_dx * dy, dx * dy};
+}
+
+/*!
+\brief Bilinear voting of an augmented event.
 
+Analogous to bilinearVoting(const Event_<T> &), but the votes are returned as events: bilinear weights are multiplied by the weight of the event, and time, polarity, depth, and stereo are propagated to its votes.
+\param event Augmented event with sub-pixel coordinates
+\return Four votes
+*/
 template <typename T>
-static inline std::array<AugmentedEvent_<T>, 4> bilinearVoting(AugmentedEvent_<T> event);
+inline std::array<AugmentedEvent_<T>, 4> bilinearVoting(const AugmentedEvent_<T> &event) {
+  const std::array<T, 4> w = bilinearVoting(static_cast<const Event_<T> &>(event));
+  const T x0 = static_cast<T>(std::floor(event.x));
+  const T y0 = static_cast<T>(std::floor(event.y));
+  std::array<AugmentedEvent_<T>, 4> votes{event, event, event, event};
+  votes[0].x = votes[2].x = x0;
+  votes[1].x = votes[3].x = x0 + 1;
+  votes[0].y = votes[1].y = y0;
+  votes[2].y = votes[3].y = y0 + 1;
+  for(std::size_t k = 0; k < 4; k++) {
+    votes[k].weight = event.weight * w[k];
+  }
+  return votes;
+}
+
+/*! \cond INTERNAL */
+namespace detail {
+template <typename T, typename Tt, typename Attributes>
+inline void bilinearVoting(const T *x, const T *y, const Tt *t, const uint8_t *p, const std::size_t n, AugmentedEventBatch_<int, Tt> &votes, Attributes &&attributes) {
+  const std::size_t offset = votes.size();
+  votes.resize(offset + 4 * n);
+  int *vx = votes.x().data() + offset;
+  int *vy = votes.y().data() + offset;
+  Tt *vt = votes.t().data() + offset;
+  uint8_t *vp = votes.p().data() + offset;
+  float *vw = votes.weight().data() + offset;
+  for(std::size_t i = 0; i < n; i++) {
+    const double fx = std::floor(static_cast<double>(x[i]));
+    const double fy = std::floor(static_cast<double>(y[i]));
+    const float dx = static_cast<float>(static_cast<double>(x[i]) - fx);
+    const float dy = static_cast<float>(static_cast<double>(y[i]) - fy);
+    const int ix = static_cast<int>(fx);
+    const int iy = static_cast<int>(fy);
+    const std::size_t j = 4 * i;
+    vx[j] = vx[j + 2] = ix;
+    vx[j + 1] = vx[j + 3] = ix + 1;
+    vy[j] = vy[j + 1] = iy;
+    vy[j + 2] = vy[j + 3] = iy + 1;
+    vt[j] = vt[j + 1] = vt[j + 2] = vt[j + 3] = t[i];
+    vp[j] = vp[j + 1] = vp[j + 2] = vp[j + 3] = p[i];
+    vw[j] = (1 - dx) * (1 - dy);
+    vw[j + 1] = dx * (1 - dy);
+    vw[j + 2] = (1 - dx) * dy;
+    vw[j + 3] = dx * dy;
+  }
+  attributes(offset);
+}
+} // namespace detail
+/*! \endcond */
+
+/*!
+\brief Bilinear voting of an event batch.
+
+Each event votes into its four neighbouring pixels (x0, y0), (x0 + 1, y0), (x0, y0 + 1), and (x0 + 1, y0 + 1) with bilinear weights. Votes are appended to the output batch column by column, so that they can be accumulated with AugmentedEventBatch_::accumulate().
+\param batch Events with sub-pixel coordinates (e.g., after undistortion or warping)
+\param votes Output batch. Four votes are appended per event.
+*/
+template <typename T, typename Tt>
+inline void bilinearVoting(const EventBatch_<T, Tt> &batch, AugmentedEventBatch_<int, Tt> &votes) {
+  detail::bilinearVoting(batch.x().data(), batch.y().data(), batch.t().data(), batch.p().data(), batch.size(), votes, [](const std::size_t /*offset*/) {});
+}
+
+/*!
+\brief Bilinear voting of an augmented event batch.
+
+Analogous to bilinearVoting(const EventBatch_<T, Tt> &, AugmentedEventBatch_<int, Tt> &), but bilinear weights are multiplied by the weight of each event, and depth and stereo are propagated to its votes.
+\param batch Augmented events with sub-pixel coordinates
+\param votes Output batch. Four votes are appended per event.
+*/
+template <typename T, typename Tt>
+inline void bilinearVoting(const AugmentedEventBatch_<T, Tt> &batch, AugmentedEventBatch_<int, Tt> &votes) {
+  detail::bilinearVoting(batch.x().data(), batch.y().data(), batch.t().data(), batch.p().data(), batch.size(), votes, [&batch, &votes](const std::size_t offset) {
+    const float *w = batch.weight().data();
+    const float *d = batch.depth().data();
+    float *vw = votes.weight().data() + offset;
+    float *vd = votes.depth().data() + offset;
+    for(std::size_t i = 0; i < batch.size(); i++) {
+      const std::size_t j = 4 * i;
+      vw[j] *= w[i];
+      vw[j + 1] *= w[i];
+      vw[j + 2] *= w[i];
+      vw[j + 3] *= w[i];
+      vd[j] = vd[j + 1] = vd[j + 2] = vd[j + 3] = d[i];
+      if(batch.stereo(i) == Stereo::RIGHT) {
+        for(std::size_t k = 0; k < 4; k++) {
+          votes.setStereo(offset + j + k, Stereo::RIGHT);
+        }
+      }
+    }
+  });
+}
 } // namespace ev
 
 #endif // OPENEV_EVPROC_VOTING_HPP
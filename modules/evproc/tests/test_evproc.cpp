@@ -0,0 +1,108 @@
+#include "openev/containers/array.hpp"
+#include "openev/containers/augmented-batch.hpp"
+#include "openev/containers/batch.hpp"
+#include "openev/containers/vector.hpp"
+#include "openev/core/types.hpp"
+#include "openev/evproc/undistortion.hpp"
+#include "openev/evproc/voting.hpp"
+#include <cmath>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <opencv2/opencv.hpp>
+#include <vector>
+
+namespace {
+ev::Vectord subpixel() {
+  ev::Vectord vector;
+  vector.emplace_back(1.25, 2.5, 1.0, true);
+  vector.emplace_back(3.0, 0.75, 2.0, false);
+  vector.emplace_back(0.1, 0.9, 3.0, true);
+  vector.emplace_back(-0.5, 4.25, 4.0, false);
+  return vector;
+}
+} // namespace
+
+TEST(Voting, BatchMatchesPerEvent) {
+  const ev::Vectord vector = subpixel();
+  ev::AugmentedEventBatch votes;
+  ev::bilinearVoting(ev::EventBatchd(vector), votes);
+  ASSERT_EQ(votes.size(), 4 * vector.size());
+  for(std::size_t i = 0; i < vector.size(); i++) {
+    const std::array<double, 4> w = ev::bilinearVoting(vector[i]);
+    const int x0 = static_cast<int>(std::floor(vector[i].x));
+    const int y0 = static_cast<int>(std::floor(vector[i].y));
+    for(std::size_t k = 0; k < 4; k++) {
+      const std::size_t j = 4 * i + k;
+      EXPECT_EQ(votes.x()[j], x0 + static_cast<int>(k % 2));
+      EXPECT_EQ(votes.y()[j], y0 + static_cast<int>(k / 2));
+      EXPECT_DOUBLE_EQ(votes.t()[j], vector[i].t);
+      EXPECT_EQ(static_cast<bool>(votes.p()[j]), vector[i].p);
+      EXPECT_NEAR(votes.weight()[j], w[k], 1e-6);
+    }
+  }
+}
+
+TEST(Voting, AugmentedBatchMatchesPerEvent) {
+  std::vector<ev::AugmentedEventd> events;
+  for(const ev::Eventd &e : subpixel()) {
+    events.emplace_back(e.x, e.y, e.t, e.p);
+  }
+  events[0].weight = 2.0;
+  events[1].depth = 3.0;
+  events[2].stereo = ev::Stereo::RIGHT;
+  events[3].weight = 0.5;
+  ev::AugmentedEventBatch votes;
+  ev::bilinearVoting(ev::AugmentedEventBatchd(events), votes);
+  ASSERT_EQ(votes.size(), 4 * events.size());
+  for(std::size_t i = 0; i < events.size(); i++) {
+    const std::array<ev::AugmentedEventd, 4> expected = ev::bilinearVoting(events[i]);
+    for(std::size_t k = 0; k < 4; k++) {
+      const ev::AugmentedEvent vote = votes[4 * i + k];
+      EXPECT_EQ(vote.x, static_cast<int>(expected[k].x));
+      EXPECT_EQ(vote.y, static_cast<int>(expected[k].y));
+      EXPECT_DOUBLE_EQ(vote.t, expected[k].t);
+      EXPECT_EQ(vote.p, expected[k].p);
+      EXPECT_NEAR(vote.weight, expected[k].weight, 1e-6);
+      EXPECT_NEAR(vote.depth, expected[k].depth, 1e-6);
+      EXPECT_EQ(vote.stereo, expected[k].stereo);
+    }
+  }
+}
+
+TEST(UndistortMap, BatchMatchesPerEvent) {
+  std::vector<cv::Point2d> points;
+  for(int y = 0; y < 6; y++) {
+    for(int x = 0; x < 8; x++) {
+      points.emplace_back(x + 0.25, 0.5 * y + 0.125);
+    }
+  }
+  const ev::UndistortMap map(points, cv::Size(8, 6));
+
+  ev::Vectorf vector;
+  vector.emplace_back(1, 2, 0.0, true);
+  vector.emplace_back(7, 5, 1.0, false);
+  vector.emplace_back(0, 0, 2.0, true);
+  ev::EventBatchf batch(vector);
+  ev::AugmentedEventBatchf augmented(batch);
+  ev::Array_<float, 3, double> array;
+  for(std::size_t i = 0; i < vector.size(); i++) {
+    array[i] = vector[i];
+  }
+
+  map(vector);
+  map(batch);
+  map(augmented);
+  map(array);
+  for(std::size_t i = 0; i < vector.size(); i++) {
+    EXPECT_FLOAT_EQ(batch.x()[i], vector[i].x);
+    EXPECT_FLOAT_EQ(batch.y()[i], vector[i].y);
+    EXPECT_FLOAT_EQ(augmented.x()[i], vector[i].x);
+    EXPECT_FLOAT_EQ(augmented.y()[i], vector[i].y);
+    EXPECT_FLOAT_EQ(array[i].x, vector[i].x);
+    EXPECT_FLOAT_EQ(array[i].y, vector[i].y);
+  }
+  EXPECT_FLOAT_EQ(vector[1].x, 7.25F);
+  EXPECT_FLOAT_EQ(vector[1].y, 2.625F);
+  EXPECT_DOUBLE_EQ(vector[1].t, 1.0);
+  EXPECT_FALSE(vector[1].p);
+}
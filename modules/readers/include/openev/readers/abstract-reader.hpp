@@ -6,13 +6,16 @@
 #ifndef OPENEV_READERS_ABSTRACT_READER_HPP
 #define OPENEV_READERS_ABSTRACT_READER_HPP
 
+#include "openev/containers/chunk-queue.hpp"
 #include "openev/containers/queue.hpp"
 #include "openev/containers/vector.hpp"
 #include "openev/core/types.hpp"
+#include "openev/core/unwrap.hpp"
 #include <atomic>
 #include <cstddef>
 #include <limits>
 #include <mutex>
+#include <optional>
 #include <thread>
 
 namespace ev {
@@ -63,6 +66,16 @@ public:
   */
   bool read(Queue &queue, const int n, const bool keep_size = false);
 
+  /*!
+  \brief Read the next chunk of events and insert it into a chunk queue.
+  \param queue Chunk queue. The chunk has up to ChunkQueue_::chunkSize events.
+  \param block If true, wait for a free slot in the queue. Otherwise, the chunk is discarded if the queue is full.
+  \return True if a full chunk was read and inserted. False if the reader ran out of events, the queue is closed, or the chunk was discarded.
+  \note Several readers (e.g., the two sides of a stereo rig) can feed the same queue from different threads.
+  \warning If block is false, a false return value does not mean that the reader ran out of events: the queue may just be full. Hence, loops such as while(reader.read(queue, false)) may stop early; use the blocking mode to feed a queue until the end of the input.
+  */
+  bool read(ChunkQueue &queue, const bool block = true);
+
   /*!
   \brief Read the next events until the specified duration is reached.
   \param vector Event vector to store the events.
@@ -100,6 +113,19 @@ public:
   */
   void reset();
 
+  /*!
+  \brief Unwrap the timestamps of the events read and check their monotonicity.
+  \param unwrapper Unwrapping stage. It is applied to every event returned by the read and skip functions.
+  \note The unwrapping stage is reset when the reader is reset.
+  */
+  void unwrap(const TimestampUnwrapper &unwrapper);
+
+  /*!
+  \brief Get the unwrapping stage, e.g., to query the number of wrap-arounds or reordered events.
+  \return Pointer to the unwrapping stage, or nullptr if unwrapping is disabled
+  */
+  [[nodiscard]] const TimestampUnwrapper *unwrapper() const;
+
   /*!
   \brief Count the total number of events available.
   \return The total number of events available.
@@ -112,13 +138,17 @@ protected:
   Queue buffer_;
   std::mutex bufferMutex_;
   std::atomic<bool> threadRunning_{};
+  std::optional<TimestampUnwrapper> unwrapper_;
 
   virtual bool read_(Event &e) = 0;
   virtual void reset_() = 0;
 
 private:
+  Vector chunk_;
+
   void threadFunction();
   bool loadBuffer();
+  bool next(Event &e);
 };
 
 } // namespace ev
@@ -21,6 +21,16 @@ ev::AbstractReader_::~AbstractReader_() {
 }
 
 bool ev::AbstractReader_::read(ev::Event &e) {
+  if(!next(e)) {
+    return false;
+  }
+  if(unwrapper_) {
+    (*unwrapper_)(e);
+  }
+  return true;
+}
+
+bool ev::AbstractReader_::next(ev::Event &e) {
   if(bufferSize_ == NO_BUFFER) {
     return read_(e);
   }
@@ -61,6 +71,16 @@ bool ev::AbstractReader_::read(ev::Queue &queue, const int n, const bool keep_si
   return n < 0;
 }
 
+bool ev::AbstractReader_::read(ev::ChunkQueue &queue, const bool block /*= true*/) {
+  chunk_.clear();
+  const bool full = read(chunk_, static_cast<int>(queue.chunkSize()));
+  if(chunk_.empty()) {
+    return false;
+  }
+  const bool inserted = block ? queue.push(chunk_) : queue.try_push(chunk_);
+  return full && inserted;
+}
+
 bool ev::AbstractReader_::read_t(ev::Vector &vector, const double t) {
   ev::Event e;
   if(vector.empty()) {
@@ -136,6 +156,10 @@ void ev::AbstractReader_::reset() {
 
   reset_();
 
+  if(unwrapper_) {
+    unwrapper_->reset();
+  }
+
   if(bufferSize_ > NO_BUFFER) {
     while(!buffer_.empty()) {
       buffer_.pop();
@@ -148,6 +172,14 @@ void ev::AbstractReader_::reset() {
   }
 }
 
+void ev::AbstractReader_::unwrap(const ev::TimestampUnwrapper &unwrapper) {
+  unwrapper_ = unwrapper;
+}
+
+const ev::TimestampUnwrapper *ev::AbstractReader_::unwrapper() const {
+  return unwrapper_ ? &*unwrapper_ : nullptr;
+}
+
 void ev::AbstractReader_::threadFunction() {
   while(threadRunning_.load() && loadBuffer()) {
     std::this_thread::sleep_for(std::chrono::milliseconds(1));
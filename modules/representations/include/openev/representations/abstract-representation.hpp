@@ -8,7 +8,7 @@
 
 #include <array>
 #include <cstddef>
-#include <float.h>
+#include <limits>
 #include <memory>
 #include <opencv2/core/hal/interface.h>
 #include <opencv2/core/mat.hpp>
@@ -23,13 +23,17 @@
 
 namespace ev {
 /*! \cond INTERNAL */
-template <typename T, std::size_t N>
+template <typename T, std::size_t N, typename Tt>
 class Array_;
-template <typename T>
+template <typename T, typename Tt>
 class Event_;
-template <typename T>
+template <typename T, typename Tt>
+class EventSpan_;
+class PackedEvent;
+class PackedVector;
+template <typename T, typename Tt, typename Alloc>
 class Queue_;
-template <typename T>
+template <typename T, typename Tt, typename Alloc>
 class Vector_;
 /*! \endcond */
 
@@ -37,7 +41,9 @@ enum RepresentationOptions : uint8_t {
   NONE = 0b00000000,
   IGNORE_POLARITY = 0b00000001,
   ONLY_IF_POSITIVE = 0b00000010,
-  ONLY_IF_NEGATIVE = 0b00000100
+  ONLY_IF_NEGATIVE = 0b00000100,
+  LAZY_CLEAR = 0b00001000, /*!< clear() is O(1): stale pixels are reset on insert() or render() (see Mat::Epoch_) */
+  TRACK_TILES = 0b00010000 /*!< Written tiles are tracked, and clear() and render() only visit them (see Mat::Tiles_) */
 };
 constexpr bool REPRESENTATION_OPTION_CHECK(const uint8_t a, const RepresentationOptions b) {
   return static_cast<bool>(a & static_cast<uint8_t>(b));
@@ -119,8 +125,10 @@ public:
 
 /*!
 \brief This is an auxiliary class. This class cannot be instanced.
+
+Template parameters are the pixel type (T), the insertion options (Options), the event coordinate type (E), and the event timebase (Tt). Time limits and time offset are kept in the event timebase, so integer timebases are processed without floating-point conversions.
 */
-template <typename T, const RepresentationOptions Options = RepresentationOptions::NONE, typename E = int>
+template <typename T, const RepresentationOptions Options = RepresentationOptions::NONE, typename E = int, typename Tt = double>
 class AbstractRepresentation_ {
 public:
   using Type = typename TypeHelper<T>::Type; /*!< Type */
@@ -145,10 +153,10 @@ public:
   \return Time difference. Returns -1 if time limits are not properly set.
   */
   [[nodiscard]] inline double duration() const {
-    if(tLimits_[MIN] == DBL_MAX || tLimits_[MAX] == DBL_MIN) {
+    if(tLimits_[MIN] == std::numeric_limits<Tt>::max() || tLimits_[MAX] == std::numeric_limits<Tt>::min()) {
       return -1;
     }
-    return tLimits_[MAX] - tLimits_[MIN];
+    return static_cast<double>(tLimits_[MAX] - tLimits_[MIN]);
   }
 
   /*!
@@ -156,10 +164,10 @@ public:
   \return Midpoint time. Returns -1 if time limits are not properly set.
   */
   [[nodiscard]] inline double midTime() const {
-    if(tLimits_[MIN] == DBL_MAX || tLimits_[MAX] == DBL_MIN) {
+    if(tLimits_[MIN] == std::numeric_limits<Tt>::max() || tLimits_[MAX] == std::numeric_limits<Tt>::min()) {
       return -1;
     }
-    return 0.5 * (tLimits_[MAX] + tLimits_[MIN]);
+    return 0.5 * (static_cast<double>(tLimits_[MAX]) + static_cast<double>(tLimits_[MIN]));
   }
 
   /*!
@@ -180,7 +188,7 @@ public:
   \return True if the event has been inserted
   \note The way in which the event is inserted should be implemented in the derived classes.
   */
-  bool insert(const Event_<E> &e);
+  bool insert(const Event_<E, Tt> &e);
 
   /*!
   \brief Insert an array of events in the representation.
@@ -188,14 +196,36 @@ public:
   \return True if all the events have been inserted
   */
   template <std::size_t N>
-  bool insert(const Array_<E, N> &array);
+  bool insert(const Array_<E, N, Tt> &array);
 
   /*!
   \brief Insert a vector of events in the representation.
   \param vector Event vector to insert
   \return True if all the events have been inserted
   */
-  bool insert(const Vector_<E> &vector);
+  template <typename Alloc>
+  bool insert(const Vector_<E, Tt, Alloc> &vector);
+
+  /*!
+  \brief Insert a span of events (e.g., a time slice of a Vector_, see Vector_::slice_t) without copying it.
+  \param span Event span to insert
+  \return True if all the events have been inserted
+  */
+  bool insert(const EventSpan_<E, Tt> &span);
+
+  /*!
+  \brief Insert a packed event in the representation.
+  \param e Packed event to insert
+  \return True if the event has been inserted
+  */
+  bool insert(const PackedEvent &e);
+
+  /*!
+  \brief Insert a vector of packed events in the representation.
+  \param vector Packed event vector to insert
+  \return True if all the events have been inserted
+  */
+  bool insert(const PackedVector &vector);
 
   /*!
   \brief Insert a queue of events in the representation.
@@ -203,15 +233,16 @@ public:
   \param keep_events_in_queue If true, events are reinserted in the queue
   \return True if all the events have been inserted
   */
-  bool insert(Queue_<E> &queue, const bool keep_events_in_queue = false);
+  template <typename Alloc>
+  bool insert(Queue_<E, Tt, Alloc> &queue, const bool keep_events_in_queue = false);
 
   /*!
   \brief Set time offset.
   \param e Event
   \warning Offset is set to match the event timestamp, i.e., \f$\tau + t = 0\f$ (where \f$ \tau \f$ is the offset and \f$ t \f$ is the timestamp of the event).
   */
-  void setTimeOffset(const Event_<E> &e) {
-    timeOffset_ = -e.t;
+  void setTimeOffset(const Event_<E, Tt> &e) {
+    timeOffset_ = Tt{0} - e.t;
   }
 
   /*!
@@ -320,14 +351,14 @@ protected:
   Type V_OFF = TypeHelper<T>::initialize()[1];
   Type V_RESET = TypeHelper<T>::initialize()[2];
 
-  double timeOffset_{0};
-  std::array<double, 2> tLimits_{DBL_MAX, DBL_MIN};
+  Tt timeOffset_{0};
+  std::array<Tt, 2> tLimits_{std::numeric_limits<Tt>::max(), std::numeric_limits<Tt>::min()};
   std::size_t count_{0};
   std::unique_ptr<cv::ColormapTypes> colormap_;
 
   virtual void clear_() = 0;
   virtual void clear_(const cv::Mat &background) = 0;
-  virtual bool insert_(const Event_<E> &e) = 0;
+  virtual bool insert_(const Event_<E, Tt> &e) = 0;
   /*! \endcond */
 };
 
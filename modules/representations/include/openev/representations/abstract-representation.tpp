@@ -5,21 +5,23 @@
 #include "openev/representation/abstract-representation.hpp"
 #endif
 
+#include "openev/containers/event-span.hpp"
+#include "openev/containers/packed.hpp"
 #include "openev/core/types.hpp"
 
 namespace ev {
 
-template <typename T, const RepresentationOptions Options, typename E>
-void AbstractRepresentation_<T, Options, E>::clear() {
+template <typename T, const RepresentationOptions Options, typename E, typename Tt>
+void AbstractRepresentation_<T, Options, E, Tt>::clear() {
   count_ = 0;
-  tLimits_ = {DBL_MAX, DBL_MIN};
+  tLimits_ = {std::numeric_limits<Tt>::max(), std::numeric_limits<Tt>::min()};
   clear_();
 }
 
-template <typename T, const RepresentationOptions Options, typename E>
-void AbstractRepresentation_<T, Options, E>::clear(const cv::Mat &background) {
+template <typename T, const RepresentationOptions Options, typename E, typename Tt>
+void AbstractRepresentation_<T, Options, E, Tt>::clear(const cv::Mat &background) {
   count_ = 0;
-  tLimits_ = {DBL_MAX, DBL_MIN};
+  tLimits_ = {std::numeric_limits<Tt>::max(), std::numeric_limits<Tt>::min()};
 
   if(background.channels() != TypeHelper<T>::NumChannels) {
     cv::Mat temp;
@@ -34,8 +36,8 @@ void AbstractRepresentation_<T, Options, E>::clear(const cv::Mat &background) {
   }
 }
 
-template <typename T, const RepresentationOptions Options, typename E>
-bool AbstractRepresentation_<T, Options, E>::insert(const Event_<E> &e) {
+template <typename T, const RepresentationOptions Options, typename E, typename Tt>
+bool AbstractRepresentation_<T, Options, E, Tt>::insert(const Event_<E, Tt> &e) {
   if constexpr(REPRESENTATION_OPTION_CHECK(Options, RepresentationOptions::ONLY_IF_POSITIVE)) {
     if(e.p == ev::NEGATIVE) {
       return false;
@@ -87,19 +89,36 @@ bool AbstractRepresentation_<T, Options, E>::insert(const Event_<E> &e) {
   }
 }
 
-template <typename T, const RepresentationOptions Options, typename E>
+template <typename T, const RepresentationOptions Options, typename E, typename Tt>
 template <std::size_t N>
-bool AbstractRepresentation_<T, Options, E>::insert(const Array_<E, N> &array) {
-  return std::all_of(array.begin(), array.end(), [this](const Event_<E> &e) { return this->insert(e); });
+bool AbstractRepresentation_<T, Options, E, Tt>::insert(const Array_<E, N, Tt> &array) {
+  return std::all_of(array.begin(), array.end(), [this](const Event_<E, Tt> &e) { return this->insert(e); });
 }
 
-template <typename T, const RepresentationOptions Options, typename E>
-bool AbstractRepresentation_<T, Options, E>::insert(const Vector_<E> &vector) {
-  return std::all_of(vector.begin(), vector.end(), [this](const Event_<E> &e) { return this->insert(e); });
+template <typename T, const RepresentationOptions Options, typename E, typename Tt>
+template <typename Alloc>
+bool AbstractRepresentation_<T, Options, E, Tt>::insert(const Vector_<E, Tt, Alloc> &vector) {
+  return std::all_of(vector.begin(), vector.end(), [this](const Event_<E, Tt> &e) { return this->insert(e); });
 }
 
-template <typename T, const RepresentationOptions Options, typename E>
-bool AbstractRepresentation_<T, Options, E>::insert(Queue_<E> &queue, const bool keep_events_in_queue /*= false*/) {
+template <typename T, const RepresentationOptions Options, typename E, typename Tt>
+bool AbstractRepresentation_<T, Options, E, Tt>::insert(const EventSpan_<E, Tt> &span) {
+  return std::all_of(span.begin(), span.end(), [this](const Event_<E, Tt> &e) { return this->insert(e); });
+}
+
+template <typename T, const RepresentationOptions Options, typename E, typename Tt>
+bool AbstractRepresentation_<T, Options, E, Tt>::insert(const PackedEvent &e) {
+  return insert(static_cast<Event_<E, Tt>>(e));
+}
+
+template <typename T, const RepresentationOptions Options, typename E, typename Tt>
+bool AbstractRepresentation_<T, Options, E, Tt>::insert(const PackedVector &vector) {
+  return std::all_of(vector.begin(), vector.end(), [this](const PackedEvent &e) { return this->insert(static_cast<Event_<E, Tt>>(e)); });
+}
+
+template <typename T, const RepresentationOptions Options, typename E, typename Tt>
+template <typename Alloc>
+bool AbstractRepresentation_<T, Options, E, Tt>::insert(Queue_<E, Tt, Alloc> &queue, const bool keep_events_in_queue /*= false*/) {
   bool ret = true;
   if(keep_events_in_queue) {
     const std::size_t size = queue.size();
@@ -9,14 +9,16 @@
 #include "openev/core/matrices.hpp"
 #include "openev/representations/abstract-representation.hpp"
 #include "openev/representations/event-image.hpp"
+#include <cstdint>
 #include <opencv2/core/hal/interface.h>
 #include <opencv2/core/mat.hpp>
 #include <opencv2/core/matx.hpp>
+#include <type_traits>
 #include <utility>
 
 namespace ev {
 /*! \cond INTERNAL */
-template <typename T>
+template <typename T, typename Tt>
 class Event_;
 /*! \endcond */
 
@@ -53,16 +55,30 @@ using EventHistogram1 = EventHistogram1b;
 using EventHistogram3 = EventHistogram3b;
 using EventHistogram = EventHistogram1;
 \endcode
+
+The storage of the counter matrix is selected with the last template parameter. By default, a signed Mat::Counter_ is used, in which ON and OFF events cancel out. With uint8_t or uint16_t, a Mat::PolarityCounter_ keeps separate saturating ON and OFF counts in an interleaved two-channel matrix, which can be given directly to a network:
+\code{.cpp}
+ev::EventHistogram_<uchar, ev::RepresentationOptions::NONE, int, double, ev::DynamicSensor, uint8_t> histogram(720, 1280);
+histogram.insert(events);
+network.setInput(histogram.counter); // cv::Mat_<cv::Vec2b>
+\endcode
 */
-template <typename T, const RepresentationOptions Options = RepresentationOptions::NONE, typename E = int>
-class EventHistogram_ : public EventImage_<T, Options, E> {
+template <typename T, const RepresentationOptions Options = RepresentationOptions::NONE, typename E = int, typename Tt = double, typename S = Sensor<>, typename Tc = int>
+class EventHistogram_ : public EventImage_<T, Options, E, Tt, S> {
+  static_assert(std::is_same_v<Tc, int> || std::is_same_v<Tc, uint8_t> || std::is_same_v<Tc, uint16_t>, "EventHistogram_: counter storage must be int, uint8_t, or uint16_t");
+
 public:
+  using CounterType = std::conditional_t<std::is_same_v<Tc, int>, Mat::Counter_<S>, Mat::PolarityCounter_<S, Tc>>; /*!< Type of the counter matrix */
+
   template <typename... Args>
-  explicit EventHistogram_(Args &&...args) : EventImage_<T, Options, E>(std::forward<Args>(args)...) {
-    EventImage_<T, Options, E>::clear();
+  explicit EventHistogram_(Args &&...args) : EventImage_<T, Options, E, Tt, S>(std::forward<Args>(args)...) {
+    if constexpr(EventImage_<T, Options, E, Tt, S>::TILED && !EventImage_<T, Options, E, Tt, S>::LAZY) {
+      counter.track();
+    }
+    EventImage_<T, Options, E, Tt, S>::clear();
   }
 
-  Mat::Counter counter{cv::Mat_<int>(EventImage_<T, Options, E>::size())}; /*!< Event counter */
+  CounterType counter{EventImage_<T, Options, E, Tt, S>::size()}; /*!< Event counter */
 
   /*!
   Event histogram matrix is generated from counter matrix.
@@ -73,7 +89,7 @@ public:
 private:
   void clear_() override;
   void clear_(const cv::Mat &background) override;
-  bool insert_(const Event_<E> &e) override;
+  bool insert_(const Event_<E, Tt> &e) override;
   int peak_{0};
 };
 using EventHistogram1b = EventHistogram_<uchar>;     /*!< Alias for EventHistogram_ using uchar */
@@ -7,73 +7,100 @@
 
 namespace ev {
 
-template <typename T, const RepresentationOptions Options, typename E>
-cv::Mat &EventHistogram_<T, Options, E>::render() {
+template <typename T, const RepresentationOptions Options, typename E, typename Tt, typename S, typename Tc>
+cv::Mat &EventHistogram_<T, Options, E, Tt, S, Tc>::render() {
+  if constexpr(EventHistogram_<T, Options, E, Tt, S, Tc>::LAZY) {
+    EventHistogram_<T, Options, E, Tt, S, Tc>::resolve(counter, typename CounterType::value_type());
+  }
   if(!peak_) {
+    if constexpr(EventHistogram_<T, Options, E, Tt, S, Tc>::LAZY) {
+      EventHistogram_<T, Options, E, Tt, S, Tc>::resolve(*this, EventHistogram_<T, Options, E, Tt, S, Tc>::V_RESET);
+    }
     return *this;
   }
 
-  cv::Mat_<double> normalized(counter);
-  normalized = normalized / peak_;
+  EventHistogram_<T, Options, E, Tt, S, Tc>::redraw([&](const cv::Rect &rect) {
+    cv::Mat dst((*this)(rect));
+    cv::Mat_<double> normalized;
+    if constexpr(std::is_same_v<Tc, int>) {
+      normalized = cv::Mat_<double>(counter(rect));
+    } else {
+      std::vector<cv::Mat> channels;
+      cv::split(counter(rect), channels);
+      normalized = cv::Mat_<double>(channels[CounterType::ON]) - cv::Mat_<double>(channels[CounterType::OFF]);
+    }
+    normalized = normalized / peak_;
 
-  if constexpr(TypeHelper<T>::NumChannels == 1) {
-    cv::Mat_<T>(
-        (EventHistogram_<T, Options, E>::V_ON - EventHistogram_<T, Options, E>::V_RESET) * normalized.mul(cv::Mat_<double>(normalized > 0) / 255) +
-        (EventHistogram_<T, Options, E>::V_RESET - EventHistogram_<T, Options, E>::V_OFF) * normalized.mul(cv::Mat_<double>(normalized < 0) / 255) +
-        EventHistogram_<T, Options, E>::V_RESET)
-        .copyTo(*this);
-  } else {
-    if(EventHistogram_<T, Options, E>::colormap_ != nullptr) {
-      if constexpr(REPRESENTATION_OPTION_CHECK(Options, RepresentationOptions::IGNORE_POLARITY)) {
-        cv::Mat aux(255 * normalized);
-        aux.convertTo(aux, CV_8UC1);
-        cv::applyColorMap(aux, *this, *EventHistogram_<T, Options, E>::colormap_);
-      } else {
-        cv::Mat aux((1 + normalized) * 128);
-        aux.convertTo(aux, CV_8UC1);
-        cv::applyColorMap(aux, *this, *EventHistogram_<T, Options, E>::colormap_);
-      }
+    if constexpr(TypeHelper<T>::NumChannels == 1) {
+      cv::Mat_<T>(
+          (EventHistogram_<T, Options, E, Tt, S, Tc>::V_ON - EventHistogram_<T, Options, E, Tt, S, Tc>::V_RESET) * normalized.mul(cv::Mat_<double>(normalized > 0) / 255) +
+          (EventHistogram_<T, Options, E, Tt, S, Tc>::V_RESET - EventHistogram_<T, Options, E, Tt, S, Tc>::V_OFF) * normalized.mul(cv::Mat_<double>(normalized < 0) / 255) +
+          EventHistogram_<T, Options, E, Tt, S, Tc>::V_RESET)
+          .copyTo(dst);
     } else {
-      const cv::Mat_<double> a(normalized.mul(cv::Mat_<double>(normalized > 0) / 255));
-      const cv::Mat_<double> b(normalized.mul(cv::Mat_<double>(normalized < 0) / 255));
-      std::vector<typename TypeHelper<T>::ChannelType> v(TypeHelper<T>::NumChannels);
-      cv::parallel_for_(cv::Range(0, TypeHelper<T>::NumChannels), [&](const cv::Range &range) {
-        const int start = range.start;
-        const int end = range.end;
-        for(int i = start; i < end; i++) {
-          typename TypeHelper<T>::ChannelType(
-              (EventHistogram_<T, Options, E>::V_ON[i] - EventHistogram_<T, Options, E>::V_RESET[i]) * a +
-              (EventHistogram_<T, Options, E>::V_RESET[i] - EventHistogram_<T, Options, E>::V_OFF[i]) * b +
-              EventHistogram_<T, Options, E>::V_RESET[i])
-              .copyTo(v[i]);
+      if(EventHistogram_<T, Options, E, Tt, S, Tc>::colormap_ != nullptr) {
+        if constexpr(REPRESENTATION_OPTION_CHECK(Options, RepresentationOptions::IGNORE_POLARITY)) {
+          cv::Mat aux(255 * normalized);
+          aux.convertTo(aux, CV_8UC1);
+          cv::applyColorMap(aux, dst, *EventHistogram_<T, Options, E, Tt, S, Tc>::colormap_);
+        } else {
+          cv::Mat aux((1 + normalized) * 128);
+          aux.convertTo(aux, CV_8UC1);
+          cv::applyColorMap(aux, dst, *EventHistogram_<T, Options, E, Tt, S, Tc>::colormap_);
         }
-      });
-      cv::merge(v, *this);
+      } else {
+        const cv::Mat_<double> a(normalized.mul(cv::Mat_<double>(normalized > 0) / 255));
+        const cv::Mat_<double> b(normalized.mul(cv::Mat_<double>(normalized < 0) / 255));
+        std::vector<typename TypeHelper<T>::ChannelType> v(TypeHelper<T>::NumChannels);
+        cv::parallel_for_(cv::Range(0, TypeHelper<T>::NumChannels), [&](const cv::Range &range) {
+          const int start = range.start;
+          const int end = range.end;
+          for(int i = start; i < end; i++) {
+            typename TypeHelper<T>::ChannelType(
+                (EventHistogram_<T, Options, E, Tt, S, Tc>::V_ON[i] - EventHistogram_<T, Options, E, Tt, S, Tc>::V_RESET[i]) * a +
+                (EventHistogram_<T, Options, E, Tt, S, Tc>::V_RESET[i] - EventHistogram_<T, Options, E, Tt, S, Tc>::V_OFF[i]) * b +
+                EventHistogram_<T, Options, E, Tt, S, Tc>::V_RESET[i])
+                .copyTo(v[i]);
+          }
+        });
+        cv::merge(v, dst);
+      }
     }
-  }
+  });
 
   return *this;
 }
 
-template <typename T, const RepresentationOptions Options, typename E>
-void EventHistogram_<T, Options, E>::clear_() {
-  EventImage_<T, Options, E>::setTo(EventHistogram_<T, Options, E>::V_RESET);
-  counter.clear();
+template <typename T, const RepresentationOptions Options, typename E, typename Tt, typename S, typename Tc>
+void EventHistogram_<T, Options, E, Tt, S, Tc>::clear_() {
+  if constexpr(!EventHistogram_<T, Options, E, Tt, S, Tc>::LAZY) {
+    counter.clear();
+  }
+  EventHistogram_<T, Options, E, Tt, S, Tc>::reset();
   peak_ = 0;
 }
 
-template <typename T, const RepresentationOptions Options, typename E>
-void EventHistogram_<T, Options, E>::clear_(const cv::Mat &background) {
-  background.copyTo(*this);
+template <typename T, const RepresentationOptions Options, typename E, typename Tt, typename S, typename Tc>
+void EventHistogram_<T, Options, E, Tt, S, Tc>::clear_(const cv::Mat &background) {
   counter.clear();
+  EventHistogram_<T, Options, E, Tt, S, Tc>::restore(background);
   peak_ = 0;
 }
 
-template <typename T, const RepresentationOptions Options, typename E>
-bool EventHistogram_<T, Options, E>::insert_(const Event_<E> &e) {
-  if(e.inside(cv::Rect(0, 0, EventImage_<T, Options, E>::cols, EventImage_<T, Options, E>::rows))) {
-    if(abs(counter.insert(e)) > peak_) {
-      peak_ = abs(counter(e));
+template <typename T, const RepresentationOptions Options, typename E, typename Tt, typename S, typename Tc>
+bool EventHistogram_<T, Options, E, Tt, S, Tc>::insert_(const Event_<E, Tt> &e) {
+  const int x = S::pixel(e.x);
+  const int y = S::pixel(e.y);
+  if(S::contains(x, y, EventImage_<T, Options, E, Tt, S>::cols, EventImage_<T, Options, E, Tt, S>::rows)) {
+    if constexpr(EventHistogram_<T, Options, E, Tt, S, Tc>::LAZY) {
+      if(EventHistogram_<T, Options, E, Tt, S, Tc>::epoch_.touch(x, y)) {
+        S::at(counter, x, y) = typename CounterType::value_type();
+      }
+    }
+    EventHistogram_<T, Options, E, Tt, S, Tc>::mark(x, y);
+    const int count = abs(counter.emplace(x, y, e.p));
+    if(count > peak_) {
+      peak_ = count;
     }
     return true;
   }
@@ -6,15 +6,18 @@
 #ifndef OPENEV_REPRESENTATIONS_EVENT_IMAGES_HPP
 #define OPENEV_REPRESENTATIONS_EVENT_IMAGES_HPP
 
+#include "openev/core/matrices.hpp"
+#include "openev/core/sensor.hpp"
 #include "openev/representations/abstract-representation.hpp"
 #include <opencv2/core/hal/interface.h>
 #include <opencv2/core/mat.hpp>
 #include <opencv2/core/matx.hpp>
+#include <opencv2/core/utils/logger.hpp>
 #include <utility>
 
 namespace ev {
 /*! \cond INTERNAL */
-template <typename T>
+template <typename T, typename Tt>
 class Event_;
 /*! \endcond */
 
@@ -51,21 +54,111 @@ using EventImage1 = EventImage1b;
 using EventImage3 = EventImage3b;
 using EventImage = EventImage1;
 \endcode
+
+The last template parameter defines the sensor geometry. By default, the geometry is taken from the size of the matrix at runtime. If a fixed geometry is given (e.g., ev::SensorDavis346), bound checks and pixel addressing use compile-time constants, and default-constructed representations have the size of the sensor:
+\code{.cpp}
+ev::EventImage_<uchar, ev::RepresentationOptions::NONE, int, double, ev::SensorDavis346> image;
+\endcode
+
+With RepresentationOptions::LAZY_CLEAR, clear() only increments a generation counter (see Mat::Epoch_), so its cost does not depend on the sensor resolution. Pixels not written since the last clear() are reset when render() is called, so the matrix must be read through render():
+\code{.cpp}
+ev::EventImage_<uchar, ev::RepresentationOptions::LAZY_CLEAR> image(720, 1280);
+\endcode
+
+With RepresentationOptions::TRACK_TILES, the tiles written since the last clear() are recorded (see Mat::Tiles_). clear(), render(), and clear(background) with the same background as the previous call only visit the dirty tiles, and tiles() gives the dirty regions, e.g., for partial display uploads when the activity is sparse:
+\code{.cpp}
+ev::EventImage_<uchar, ev::RepresentationOptions::TRACK_TILES> image(720, 1280);
+image.insert(events);
+image.tiles().forEach([&](const cv::Rect &rect) { upload(image(rect)); });
+\endcode
 */
-template <typename T, const RepresentationOptions Options = RepresentationOptions::NONE, typename E = int>
-class EventImage_ : public cv::Mat_<T>, public AbstractRepresentation_<T, Options, E> {
+template <typename T, const RepresentationOptions Options = RepresentationOptions::NONE, typename E = int, typename Tt = double, typename S = Sensor<>>
+class EventImage_ : public cv::Mat_<T>, public AbstractRepresentation_<T, Options, E, Tt> {
 public:
   template <typename... Args>
   explicit EventImage_(Args &&...args) : cv::Mat_<T>(std::forward<Args>(args)...) {
-    AbstractRepresentation_<T, Options, E>::clear();
+    if constexpr(S::FIXED) {
+      if(!S::valid(*this)) {
+        if(!cv::Mat_<T>::empty()) {
+          CV_LOG_ERROR(nullptr, "EventImage: Size does not match the sensor geometry");
+        }
+        cv::Mat_<T>::create(S::HEIGHT, S::WIDTH);
+      }
+    }
+    if constexpr(LAZY) {
+      epoch_ = Mat::Epoch_<S>(cv::Mat_<T>::rows, cv::Mat_<T>::cols);
+    }
+    if constexpr(TILED) {
+      tiles_ = Mat::Tiles_<S>(cv::Mat_<T>::rows, cv::Mat_<T>::cols);
+      stale_ = Mat::Tiles_<S>(cv::Mat_<T>::rows, cv::Mat_<T>::cols);
+      tiles_.mark();
+    }
+    AbstractRepresentation_<T, Options, E, Tt>::clear();
+  }
+
+  cv::Mat &render() {
+    if constexpr(LAZY) {
+      resolve(*this, EventImage_<T, Options, E, Tt, S>::V_RESET);
+      if constexpr(TILED) {
+        stale_.clear();
+      }
+    }
+    return *this;
+  }
+
+  /*!
+  \brief Tiles written since the last clear.
+  \return Tiles (always clean unless RepresentationOptions::TRACK_TILES is set)
+  */
+  [[nodiscard]] const Mat::Tiles_<S> &tiles() const { return tiles_; }
+
+protected:
+  static constexpr bool LAZY = REPRESENTATION_OPTION_CHECK(Options, RepresentationOptions::LAZY_CLEAR);
+  static constexpr bool TILED = REPRESENTATION_OPTION_CHECK(Options, RepresentationOptions::TRACK_TILES);
+  Mat::Epoch_<S> epoch_{0, 0};
+  Mat::Tiles_<S> tiles_{0, 0};
+
+  void reset();
+  void restore(const cv::Mat &background);
+
+  inline void mark(const int x, const int y) {
+    if constexpr(TILED) {
+      tiles_.mark(x, y);
+    }
   }
 
-  cv::Mat &render() { return *this; }
+  template <typename Tp>
+  inline void resolve(cv::Mat_<Tp> &m, const Tp &value) const {
+    if constexpr(TILED) {
+      stale_.forEach([&](const cv::Rect &rect) { epoch_.resolve(m, value, rect); });
+    } else {
+      epoch_.resolve(m, value);
+    }
+  }
+
+  template <typename F>
+  inline void redraw(F &&f) {
+    if constexpr(TILED) {
+      stale_ |= tiles_;
+      if(background_.empty()) {
+        stale_.forEach(f);
+        stale_.clear();
+        return;
+      }
+      background_.release();
+      stale_.clear();
+    }
+    f(cv::Rect(0, 0, cv::Mat_<T>::cols, cv::Mat_<T>::rows));
+  }
 
 private:
+  Mat::Tiles_<S> stale_{0, 0};
+  cv::Mat background_;
+  T filled_{};
+
   void clear_() override;
   void clear_(const cv::Mat &background) override;
-  bool insert_(const Event_<E> &e) override;
+  bool insert_(const Event_<E, Tt> &e) override;
 };
 using EventImage1b = EventImage_<uchar>;     /*!< Alias for EventImage_ using uchar */
 using EventImage2b = EventImage_<cv::Vec2b>; /*!< Alias for EventImage_ using cv::Vec2b */
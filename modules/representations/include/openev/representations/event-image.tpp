@@ -7,20 +7,74 @@
 
 namespace ev {
 
-template <typename T, const RepresentationOptions Options, typename E>
-void EventImage_<T, Options, E>::clear_() {
-  cv::Mat_<T>::setTo(EventImage_<T, Options, E>::V_RESET);
+template <typename T, const RepresentationOptions Options, typename E, typename Tt, typename S>
+void EventImage_<T, Options, E, Tt, S>::reset() {
+  const T &value = EventImage_<T, Options, E, Tt, S>::V_RESET;
+  bool full = true;
+  if constexpr(TILED) {
+    full = !background_.empty() || !(filled_ == value);
+    background_.release();
+    filled_ = value;
+  }
+  if constexpr(LAZY) {
+    epoch_.clear();
+    if constexpr(TILED) {
+      stale_ |= tiles_;
+      if(full) {
+        stale_.mark();
+      }
+    }
+  } else if(full) {
+    S::template fill<T>(*this, value);
+  } else {
+    tiles_.fill(*this, value);
+  }
+  if constexpr(TILED) {
+    tiles_.clear();
+  }
+}
+
+template <typename T, const RepresentationOptions Options, typename E, typename Tt, typename S>
+void EventImage_<T, Options, E, Tt, S>::restore(const cv::Mat &background) {
+  if constexpr(TILED) {
+    if(background.data == background_.data && background.size() == background_.size() && background.type() == background_.type()) {
+      tiles_.copy(background, *this);
+      stale_.copy(background, *this);
+    } else {
+      background.copyTo(*this);
+    }
+    background_ = background;
+    stale_.clear();
+    tiles_.clear();
+  } else {
+    background.copyTo(*this);
+  }
+  if constexpr(LAZY) {
+    epoch_.clear();
+    epoch_.touch();
+  }
+}
+
+template <typename T, const RepresentationOptions Options, typename E, typename Tt, typename S>
+void EventImage_<T, Options, E, Tt, S>::clear_() {
+  reset();
 }
 
-template <typename T, const RepresentationOptions Options, typename E>
-void EventImage_<T, Options, E>::clear_(const cv::Mat &background) {
-  background.copyTo(*this);
+template <typename T, const RepresentationOptions Options, typename E, typename Tt, typename S>
+void EventImage_<T, Options, E, Tt, S>::clear_(const cv::Mat &background) {
+  restore(background);
 }
 
-template <typename T, const RepresentationOptions Options, typename E>
-bool EventImage_<T, Options, E>::insert_(const Event_<E> &e) {
-  if(e.inside(cv::Rect(0, 0, cv::Mat_<T>::cols, cv::Mat_<T>::rows))) {
-    cv::Mat_<T>::operator()(e.y, e.x) = e.p ? EventImage_<T, Options, E>::V_ON : EventImage_<T, Options, E>::V_OFF;
+template <typename T, const RepresentationOptions Options, typename E, typename Tt, typename S>
+bool EventImage_<T, Options, E, Tt, S>::insert_(const Event_<E, Tt> &e) {
+  const int x = S::pixel(e.x);
+  const int y = S::pixel(e.y);
+  if(S::contains(x, y, cv::Mat_<T>::cols, cv::Mat_<T>::rows)) {
+    if constexpr(LAZY) {
+      epoch_.touch(x, y);
+    }
+    mark(x, y);
+    S::at(*this, x, y) = e.p ? EventImage_<T, Options, E, Tt, S>::V_ON : EventImage_<T, Options, E, Tt, S>::V_OFF;
     return true;
   }
   return false;
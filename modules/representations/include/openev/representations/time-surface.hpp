@@ -22,7 +22,7 @@ class Mat;
 
 namespace ev {
 /*! \cond INTERNAL */
-template <typename T>
+template <typename T, typename Tt>
 class Event_;
 /*! \endcond */
 
@@ -59,20 +59,39 @@ using TimeSurface1 = TimeSurface1b;
 using TimeSurface3 = TimeSurface3b;
 using TimeSurface = TimeSurface1;
 \endcode
+
+The storage of the time matrix is selected with the last template parameter (see Mat::Time_). Single-precision or int32_t storage halves the memory footprint, and render() then runs in single precision:
+\code{.cpp}
+ev::TimeSurface_<uchar, ev::RepresentationOptions::NONE, int, double, ev::DynamicSensor, float> ts(720, 1280);
+ts.time.setTick(1e-6); // Timestamps in seconds, microsecond resolution
+\endcode
+
+\warning The polarity member is a bit-packed Mat::PackedPolarity_, so that render() builds its ON/OFF masks from 64-bit words. It used to be a Mat::Polarity_ (i.e., a cv::Mat_<bool>), and code that uses it as a cv::Mat must be migrated:
+\code{.cpp}
+bool p = ts.polarity(y, x);                     // Reading a pixel is unchanged
+ts.polarity.set(x, y, true);                    // Instead of ts.polarity(y, x) = true
+ts.polarity.clear();                            // Instead of ts.polarity.setTo(0)
+cv::Mat_<uchar> on;
+ts.polarity.toMask(on, true);                   // Instead of ts.polarity == 1 (255 where ON, 0 elsewhere)
+cv::Mat_<bool> polarity = ts.polarity.unpack(); // Byte-per-pixel copy, e.g., for at<bool>(y, x) or copyTo()
+\endcode
 */
 enum class Kernel { NONE,
                     LINEAR,
                     EXPONENTIAL };
-template <typename T, const RepresentationOptions Options = RepresentationOptions::NONE, typename E = int>
-class TimeSurface_ : public EventImage_<T, Options, E> {
+template <typename T, const RepresentationOptions Options = RepresentationOptions::NONE, typename E = int, typename Tt = double, typename S = Sensor<>, typename Ts = double>
+class TimeSurface_ : public EventImage_<T, Options, E, Tt, S> {
 public:
   template <typename... Args>
-  explicit TimeSurface_(Args &&...args) : EventImage_<T, Options, E>(std::forward<Args>(args)...) {
-    EventImage_<T, Options, E>::clear();
+  explicit TimeSurface_(Args &&...args) : EventImage_<T, Options, E, Tt, S>(std::forward<Args>(args)...) {
+    if constexpr(EventImage_<T, Options, E, Tt, S>::TILED && !EventImage_<T, Options, E, Tt, S>::LAZY) {
+      time.track();
+    }
+    EventImage_<T, Options, E, Tt, S>::clear();
   }
 
-  Mat::Time time{this->size()};         /*!< Time matrix */
-  Mat::Polarity polarity{this->size()}; /*!< Polarity matrix */
+  Mat::Time_<S, Ts> time{this->size()};           /*!< Time matrix */
+  Mat::PackedPolarity_<S> polarity{this->size()}; /*!< Polarity matrix (bit-packed, see the migration note above) */
 
   /*!
   Timesurface matrix is generated from timestamp and polarity matrices.
@@ -86,7 +105,7 @@ public:
 private:
   void clear_() override;
   void clear_(const cv::Mat &background) override;
-  bool insert_(const Event_<E> &e) override;
+  bool insert_(const Event_<E, Tt> &e) override;
 };
 using TimeSurface1b = TimeSurface_<uchar>;     /*!< Alias for TimeSurface_ using uchar */
 using TimeSurface2b = TimeSurface_<cv::Vec2b>; /*!< Alias for TimeSurface_ using cv::Vec2b */
@@ -7,79 +7,104 @@
 
 namespace ev {
 
-template <typename T, const RepresentationOptions Options, typename E>
-cv::Mat &TimeSurface_<T, Options, E>::render(const Kernel kernel /*= Kernel::NONE*/, const double tau /*= 0*/) {
+template <typename T, const RepresentationOptions Options, typename E, typename Tt, typename S, typename Ts>
+cv::Mat &TimeSurface_<T, Options, E, Tt, S, Ts>::render(const Kernel kernel /*= Kernel::NONE*/, const double tau /*= 0*/) {
   CV_LOG_ERROR(nullptr, "TimeSurface::applyKernel: tau value must be greater that zero", kernel == Kernel::NONE || tau > 0);
-  if(TimeSurface_<T, Options, E>::tLimits_[TimeSurface_<T, Options, E>::MAX] < 0) {
+  if(static_cast<double>(TimeSurface_<T, Options, E, Tt, S, Ts>::tLimits_[TimeSurface_<T, Options, E, Tt, S, Ts>::MAX]) < 0) {
+    if constexpr(TimeSurface_<T, Options, E, Tt, S, Ts>::LAZY) {
+      TimeSurface_<T, Options, E, Tt, S, Ts>::resolve(*this, TimeSurface_<T, Options, E, Tt, S, Ts>::V_RESET);
+    }
     return *this;
   }
+  if constexpr(TimeSurface_<T, Options, E, Tt, S, Ts>::LAZY) {
+    TimeSurface_<T, Options, E, Tt, S, Ts>::resolve(time, Ts{0});
+  }
 
-  cv::Mat_<double> ts;
+  using Tr = typename Mat::Time_<S, Ts>::RenderType;
+  cv::Mat_<Tr> ts;
   switch(kernel) {
   case Kernel::NONE:
-    cv::normalize(time, ts, 0, 1, cv::NORM_MINMAX, -1, time > 0);
+    cv::normalize(time, ts, 0, 1, cv::NORM_MINMAX, cv::DataType<Tr>::depth, time > 0);
     break;
   case Kernel::LINEAR:
-    ts = cv::Mat_<double>(1.0 + (time - TimeSurface_<T, Options, E>::tLimits_[TimeSurface_<T, Options, E>::MAX]) / tau);
+    time.relative(static_cast<double>(TimeSurface_<T, Options, E, Tt, S, Ts>::tLimits_[TimeSurface_<T, Options, E, Tt, S, Ts>::MAX]), ts);
+    ts = cv::Mat_<Tr>(1.0 + ts / tau);
     ts.setTo(0, ts < 0);
     break;
   case Kernel::EXPONENTIAL:
-    cv::exp((time - TimeSurface_<T, Options, E>::tLimits_[TimeSurface_<T, Options, E>::MAX]) / tau, ts);
+    time.relative(static_cast<double>(TimeSurface_<T, Options, E, Tt, S, Ts>::tLimits_[TimeSurface_<T, Options, E, Tt, S, Ts>::MAX]), ts);
+    cv::exp(ts / tau, ts);
     break;
   }
 
-  if constexpr(TypeHelper<T>::NumChannels == 1) {
-    cv::Mat_<T>(ts * (TimeSurface_<T, Options, E>::V_ON - TimeSurface_<T, Options, E>::V_RESET) + TimeSurface_<T, Options, E>::V_RESET).copyTo(*this, polarity == 1);
-    cv::Mat_<T>(ts * (TimeSurface_<T, Options, E>::V_OFF - TimeSurface_<T, Options, E>::V_RESET) + TimeSurface_<T, Options, E>::V_RESET).copyTo(*this, polarity == 0);
-  } else {
-    if(TimeSurface_<T, Options, E>::colormap_ != nullptr) {
-      if constexpr(REPRESENTATION_OPTION_CHECK(Options, RepresentationOptions::IGNORE_POLARITY)) {
-        cv::Mat aux(255 * ts);
-        aux.convertTo(aux, CV_8UC1);
-        cv::applyColorMap(aux, *this, *TimeSurface_<T, Options, E>::colormap_);
-      } else {
-        cv::Mat aux;
-        cv::Mat(128 + ts * 127).copyTo(aux, polarity == 1);
-        cv::Mat(128 - ts * 128).copyTo(aux, polarity == 0);
-        aux.convertTo(aux, CV_8UC1);
-        cv::applyColorMap(aux, *this, *TimeSurface_<T, Options, E>::colormap_);
-      }
+  cv::Mat_<uchar> on;
+  cv::Mat_<uchar> off;
+  polarity.toMask(on, true);
+  polarity.toMask(off, false);
+
+  TimeSurface_<T, Options, E, Tt, S, Ts>::redraw([&](const cv::Rect &rect) {
+    cv::Mat dst((*this)(rect));
+    if constexpr(TypeHelper<T>::NumChannels == 1) {
+      cv::Mat_<T>(ts(rect) * (TimeSurface_<T, Options, E, Tt, S, Ts>::V_ON - TimeSurface_<T, Options, E, Tt, S, Ts>::V_RESET) + TimeSurface_<T, Options, E, Tt, S, Ts>::V_RESET).copyTo(dst, on(rect));
+      cv::Mat_<T>(ts(rect) * (TimeSurface_<T, Options, E, Tt, S, Ts>::V_OFF - TimeSurface_<T, Options, E, Tt, S, Ts>::V_RESET) + TimeSurface_<T, Options, E, Tt, S, Ts>::V_RESET).copyTo(dst, off(rect));
     } else {
-      std::vector<typename TypeHelper<T>::ChannelType> v(TypeHelper<T>::NumChannels);
-      cv::parallel_for_(cv::Range(0, TypeHelper<T>::NumChannels), [&](const cv::Range &range) {
-        const int start = range.start;
-        const int end = range.end;
-        for(int i = start; i < end; i++) {
-          typename TypeHelper<T>::ChannelType(ts * (TimeSurface_<T, Options, E>::V_ON[i] - TimeSurface_<T, Options, E>::V_RESET[i]) + TimeSurface_<T, Options, E>::V_RESET[i]).copyTo(v[i], polarity == 1);
-          typename TypeHelper<T>::ChannelType(ts * (TimeSurface_<T, Options, E>::V_OFF[i] - TimeSurface_<T, Options, E>::V_RESET[i]) + TimeSurface_<T, Options, E>::V_RESET[i]).copyTo(v[i], polarity == 0);
+      if(TimeSurface_<T, Options, E, Tt, S, Ts>::colormap_ != nullptr) {
+        if constexpr(REPRESENTATION_OPTION_CHECK(Options, RepresentationOptions::IGNORE_POLARITY)) {
+          cv::Mat aux(255 * ts(rect));
+          aux.convertTo(aux, CV_8UC1);
+          cv::applyColorMap(aux, dst, *TimeSurface_<T, Options, E, Tt, S, Ts>::colormap_);
+        } else {
+          cv::Mat aux;
+          cv::Mat(128 + ts(rect) * 127).copyTo(aux, on(rect));
+          cv::Mat(128 - ts(rect) * 128).copyTo(aux, off(rect));
+          aux.convertTo(aux, CV_8UC1);
+          cv::applyColorMap(aux, dst, *TimeSurface_<T, Options, E, Tt, S, Ts>::colormap_);
         }
-      });
-      cv::merge(v, *this);
+      } else {
+        std::vector<typename TypeHelper<T>::ChannelType> v(TypeHelper<T>::NumChannels);
+        cv::parallel_for_(cv::Range(0, TypeHelper<T>::NumChannels), [&](const cv::Range &range) {
+          const int start = range.start;
+          const int end = range.end;
+          for(int i = start; i < end; i++) {
+            typename TypeHelper<T>::ChannelType(ts(rect) * (TimeSurface_<T, Options, E, Tt, S, Ts>::V_ON[i] - TimeSurface_<T, Options, E, Tt, S, Ts>::V_RESET[i]) + TimeSurface_<T, Options, E, Tt, S, Ts>::V_RESET[i]).copyTo(v[i], on(rect));
+            typename TypeHelper<T>::ChannelType(ts(rect) * (TimeSurface_<T, Options, E, Tt, S, Ts>::V_OFF[i] - TimeSurface_<T, Options, E, Tt, S, Ts>::V_RESET[i]) + TimeSurface_<T, Options, E, Tt, S, Ts>::V_RESET[i]).copyTo(v[i], off(rect));
+          }
+        });
+        cv::merge(v, dst);
+      }
     }
-  }
+  });
 
   return *this;
 }
 
-template <typename T, const RepresentationOptions Options, typename E>
-void TimeSurface_<T, Options, E>::clear_() {
-  this->setTo(TimeSurface_<T, Options, E>::V_RESET);
-  time.clear();
-  polarity.clear();
+template <typename T, const RepresentationOptions Options, typename E, typename Tt, typename S, typename Ts>
+void TimeSurface_<T, Options, E, Tt, S, Ts>::clear_() {
+  if constexpr(!TimeSurface_<T, Options, E, Tt, S, Ts>::LAZY) {
+    time.clear();
+    polarity.clear();
+  }
+  TimeSurface_<T, Options, E, Tt, S, Ts>::reset();
 }
 
-template <typename T, const RepresentationOptions Options, typename E>
-void TimeSurface_<T, Options, E>::clear_(const cv::Mat &background) {
-  background.copyTo(*this);
+template <typename T, const RepresentationOptions Options, typename E, typename Tt, typename S, typename Ts>
+void TimeSurface_<T, Options, E, Tt, S, Ts>::clear_(const cv::Mat &background) {
   time.clear();
   polarity.clear();
+  TimeSurface_<T, Options, E, Tt, S, Ts>::restore(background);
 }
 
-template <typename T, const RepresentationOptions Options, typename E>
-bool TimeSurface_<T, Options, E>::insert_(const Event_<E> &e) {
-  if(e.inside(cv::Rect(0, 0, this->cols, this->rows))) {
-    time.insert(e);
-    polarity.insert(e);
+template <typename T, const RepresentationOptions Options, typename E, typename Tt, typename S, typename Ts>
+bool TimeSurface_<T, Options, E, Tt, S, Ts>::insert_(const Event_<E, Tt> &e) {
+  const int x = S::pixel(e.x);
+  const int y = S::pixel(e.y);
+  if(S::contains(x, y, this->cols, this->rows)) {
+    if constexpr(TimeSurface_<T, Options, E, Tt, S, Ts>::LAZY) {
+      TimeSurface_<T, Options, E, Tt, S, Ts>::epoch_.touch(x, y);
+    }
+    TimeSurface_<T, Options, E, Tt, S, Ts>::mark(x, y);
+    time.emplace(x, y, e.t);
+    polarity.emplace(x, y, e.p);
     return true;
   }
   return false;
@@ -0,0 +1,145 @@
+#include "openev/containers/vector.hpp"
+#include "openev/representations/event-histogram.hpp"
+#include "openev/representations/event-image.hpp"
+#include "openev/representations/time-surface.hpp"
+#include <gtest/gtest.h>
+#include <memory>
+#include <opencv2/opencv.hpp>
+#include <random>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace {
+constexpr int ROWS = 70;
+constexpr int COLS = 100;
+constexpr int CYCLES = 12;
+constexpr ev::RepresentationOptions LAZY_TILES = static_cast<ev::RepresentationOptions>(ev::RepresentationOptions::LAZY_CLEAR | ev::RepresentationOptions::TRACK_TILES);
+
+template <typename T>
+::testing::AssertionResult identical(const cv::Mat_<T> &a, const cv::Mat_<T> &b) {
+  if(a.size() != b.size()) {
+    return ::testing::AssertionFailure() << "different sizes";
+  }
+  for(int y = 0; y < a.rows; y++) {
+    for(int x = 0; x < a.cols; x++) {
+      if(a(y, x) != b(y, x)) {
+        return ::testing::AssertionFailure() << "pixel (" << x << ", " << y << "): " << +a(y, x) << " != " << +b(y, x);
+      }
+    }
+  }
+  return ::testing::AssertionSuccess();
+}
+
+// Events of a cycle are clustered in a window that moves between cycles, so that different tiles become dirty. Some cycles are empty. Floating-point coordinates have a fractional part, so that some of them are rounded up.
+template <typename E>
+ev::Vector_<E> burst(std::mt19937 &rng, const int k) {
+  ev::Vector_<E> events;
+  if(k % 5 == 4) {
+    return events;
+  }
+  std::uniform_int_distribution<int> offset(0, 19);
+  std::bernoulli_distribution polarity(0.5);
+  const int x0 = (37 * k) % (COLS - 20);
+  const int y0 = (23 * k) % (ROWS - 20);
+  for(int i = 0; i < 60; i++) {
+    const E fraction = std::is_floating_point_v<E> ? static_cast<E>(0.3 * (i % 3)) : E{0};
+    events.emplace_back(x0 + offset(rng) + fraction, y0 + offset(rng) + fraction, 100.0 * k + i, polarity(rng));
+  }
+  return events;
+}
+
+// Replays the same stream (with coordinates of type E) in several representations, clearing them (with and without background) between cycles, and checks that the rendered images and the internal matrices (see state) are identical.
+template <typename E, typename A, typename... B, typename F, typename G>
+void equivalentWith(F &&render, G &&state) {
+  A reference(ROWS, COLS);
+  std::tuple<std::unique_ptr<B>...> others{std::make_unique<B>(ROWS, COLS)...};
+  const cv::Mat_<uchar> background(ROWS, COLS, uchar{64});
+  std::mt19937 rng(42);
+  for(int k = 0; k < CYCLES; k++) {
+    const ev::Vector_<E> events = burst<E>(rng, k);
+    const auto replay = [&](auto &representation) {
+      if(k % 4 >= 2) {
+        representation.clear(background);
+      } else {
+        representation.clear();
+      }
+      representation.insert(events);
+      render(representation);
+    };
+    const auto check = [&](const auto &representation) {
+      EXPECT_TRUE(identical<uchar>(reference, representation)) << "cycle " << k;
+      EXPECT_TRUE(identical(state(reference), state(representation))) << "cycle " << k;
+    };
+    replay(reference);
+    std::apply([&](auto &...other) { (replay(*other), ...); }, others);
+    std::apply([&](const auto &...other) { (check(*other), ...); }, others);
+  }
+}
+
+template <typename A, typename... B, typename F, typename G>
+void equivalent(F &&render, G &&state) {
+  equivalentWith<int, A, B...>(std::forward<F>(render), std::forward<G>(state));
+}
+
+// Inserts events on both sides of the boundary between the first two tiles, and checks that the tile of the written pixel is the one marked dirty.
+template <typename A>
+void boundary() {
+  A representation(ROWS, COLS);
+  representation.insert(ev::Eventf(31.6F, 10.2F, 1.0, ev::POSITIVE));
+  representation.insert(ev::Eventf(63.4F, 40.5F, 2.0, ev::NEGATIVE));
+  const int tile = representation.tiles().tile();
+  ASSERT_EQ(tile, 32);
+  EXPECT_TRUE(representation.tiles().dirty(32, 10));
+  EXPECT_FALSE(representation.tiles().dirty(31, 10));
+  EXPECT_TRUE(representation.tiles().dirty(63, 41));
+  EXPECT_FALSE(representation.tiles().dirty(64, 41));
+  EXPECT_EQ(representation.tiles().count(), 2U);
+}
+} // namespace
+
+TEST(TrackTiles, EventImage) {
+  equivalent<ev::EventImage_<uchar>, ev::EventImage_<uchar, ev::RepresentationOptions::TRACK_TILES>, ev::EventImage_<uchar, LAZY_TILES>>([](auto &image) { image.render(); }, [](const auto &image) -> const cv::Mat_<uchar> & { return image; });
+}
+
+TEST(TrackTiles, EventHistogram) {
+  equivalent<ev::EventHistogram_<uchar>, ev::EventHistogram_<uchar, ev::RepresentationOptions::TRACK_TILES>, ev::EventHistogram_<uchar, LAZY_TILES>>([](auto &histogram) { histogram.render(); }, [](const auto &histogram) -> const cv::Mat_<int> & { return histogram.counter; });
+}
+
+TEST(TrackTiles, TimeSurface) {
+  const auto state = [](const auto &surface) -> const cv::Mat_<double> & { return surface.time; };
+  equivalent<ev::TimeSurface_<uchar>, ev::TimeSurface_<uchar, ev::RepresentationOptions::TRACK_TILES>, ev::TimeSurface_<uchar, LAZY_TILES>>([](auto &surface) { surface.render(); }, state);
+  equivalent<ev::TimeSurface_<uchar>, ev::TimeSurface_<uchar, ev::RepresentationOptions::TRACK_TILES>, ev::TimeSurface_<uchar, LAZY_TILES>>([](auto &surface) { surface.render(ev::Kernel::LINEAR, 500); }, state);
+}
+
+TEST(TrackTiles, FloatCoordinates) {
+  equivalentWith<float, ev::EventImage_<uchar, ev::RepresentationOptions::NONE, float>, ev::EventImage_<uchar, ev::RepresentationOptions::TRACK_TILES, float>, ev::EventImage_<uchar, LAZY_TILES, float>>([](auto &image) { image.render(); }, [](const auto &image) -> const cv::Mat_<uchar> & { return image; });
+  equivalentWith<float, ev::EventHistogram_<uchar, ev::RepresentationOptions::NONE, float>, ev::EventHistogram_<uchar, ev::RepresentationOptions::TRACK_TILES, float>, ev::EventHistogram_<uchar, LAZY_TILES, float>>([](auto &histogram) { histogram.render(); }, [](const auto &histogram) -> const cv::Mat_<int> & { return histogram.counter; });
+  equivalentWith<float, ev::TimeSurface_<uchar, ev::RepresentationOptions::NONE, float>, ev::TimeSurface_<uchar, ev::RepresentationOptions::TRACK_TILES, float>, ev::TimeSurface_<uchar, LAZY_TILES, float>>([](auto &surface) { surface.render(); }, [](const auto &surface) -> const cv::Mat_<double> & { return surface.time; });
+}
+
+TEST(TrackTiles, TileBoundary) {
+  boundary<ev::EventImage_<uchar, ev::RepresentationOptions::TRACK_TILES, float>>();
+  boundary<ev::EventHistogram_<uchar, ev::RepresentationOptions::TRACK_TILES, float>>();
+  boundary<ev::TimeSurface_<uchar, ev::RepresentationOptions::TRACK_TILES, float>>();
+}
+
+TEST(LazyClear, EventImage) {
+  equivalent<ev::EventImage_<uchar>, ev::EventImage_<uchar, ev::RepresentationOptions::LAZY_CLEAR>>([](auto &image) { image.render(); }, [](const auto &image) -> const cv::Mat_<uchar> & { return image; });
+}
+
+TEST(LazyClear, EventHistogram) {
+  equivalent<ev::EventHistogram_<uchar>, ev::EventHistogram_<uchar, ev::RepresentationOptions::LAZY_CLEAR>>([](auto &histogram) { histogram.render(); }, [](const auto &histogram) -> const cv::Mat_<int> & { return histogram.counter; });
+}
+
+TEST(LazyClear, TimeSurface) {
+  const auto state = [](const auto &surface) -> const cv::Mat_<double> & { return surface.time; };
+  equivalent<ev::TimeSurface_<uchar>, ev::TimeSurface_<uchar, ev::RepresentationOptions::LAZY_CLEAR>>([](auto &surface) { surface.render(); }, state);
+  equivalent<ev::TimeSurface_<uchar>, ev::TimeSurface_<uchar, ev::RepresentationOptions::LAZY_CLEAR>>([](auto &surface) { surface.render(ev::Kernel::LINEAR, 500); }, state);
+}
+
+TEST(LazyClear, FloatCoordinates) {
+  equivalentWith<float, ev::EventImage_<uchar, ev::RepresentationOptions::NONE, float>, ev::EventImage_<uchar, ev::RepresentationOptions::LAZY_CLEAR, float>>([](auto &image) { image.render(); }, [](const auto &image) -> const cv::Mat_<uchar> & { return image; });
+  equivalentWith<float, ev::EventHistogram_<uchar, ev::RepresentationOptions::NONE, float>, ev::EventHistogram_<uchar, ev::RepresentationOptions::LAZY_CLEAR, float>>([](auto &histogram) { histogram.render(); }, [](const auto &histogram) -> const cv::Mat_<int> & { return histogram.counter; });
+  equivalentWith<float, ev::TimeSurface_<uchar, ev::RepresentationOptions::NONE, float>, ev::TimeSurface_<uchar, ev::RepresentationOptions::LAZY_CLEAR, float>>([](auto &surface) { surface.render(); }, [](const auto &surface) -> const cv::Mat_<double> & { return surface.time; });
+}